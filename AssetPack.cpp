@@ -0,0 +1,238 @@
+#include "AssetPack.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Static member definitions
+const std::uint8_t* AssetPack::base = nullptr;
+size_t AssetPack::size = 0;
+const AssetPack::Entry* AssetPack::entries = nullptr;
+std::uint32_t AssetPack::entryCount = 0;
+
+namespace {
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+
+    // Map a whole file read-only; returns nullptr on failure
+    const std::uint8_t* mapFile(const std::string& path, size_t& mappedSize) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) return nullptr;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(fileHandle);
+            fileHandle = INVALID_HANDLE_VALUE;
+            return nullptr;
+        }
+
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            if (mappingHandle) CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+            mappingHandle = nullptr;
+            fileHandle = INVALID_HANDLE_VALUE;
+            return nullptr;
+        }
+
+        mappedSize = static_cast<size_t>(fileSize.QuadPart);
+        return static_cast<const std::uint8_t*>(view);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return nullptr;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);   // The mapping keeps the file alive
+        if (view == MAP_FAILED) return nullptr;
+
+        mappedSize = static_cast<size_t>(info.st_size);
+        return static_cast<const std::uint8_t*>(view);
+#endif
+    }
+
+    void unmapFile(const std::uint8_t* data, size_t mappedSize) {
+#ifdef _WIN32
+        (void)mappedSize;
+        UnmapViewOfFile(data);
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        munmap(const_cast<std::uint8_t*>(data), mappedSize);
+#endif
+    }
+
+    // True if [offset, offset + length) lies inside a file of fileSize bytes
+    bool inRange(std::uint64_t offset, std::uint64_t length, size_t fileSize) {
+        return offset <= fileSize && length <= fileSize - offset;
+    }
+
+    // Zone records are whole int32s, so an aligned zones block keeps the labels after it aligned too
+    static_assert(sizeof(AssetPack::Zone) % alignof(std::uint32_t) == 0, "Zone size breaks label alignment");
+
+    // Check every entry's name and data against the file size, so lookups never read past the mapping.
+    // Overlay label values are not checked here; CardTemplate bounds them by zoneCount before use.
+    bool validateEntries(const AssetPack::Entry* entries, std::uint32_t count, size_t fileSize) {
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const AssetPack::Entry& entry = entries[i];
+            if (!inRange(entry.nameOffset, entry.nameLength, fileSize)) return false;
+
+            const std::uint64_t pixelBytes = static_cast<std::uint64_t>(entry.width) * entry.height * 4;
+            switch (entry.kind) {
+            case AssetPack::Kind::Image:
+            case AssetPack::Kind::AtlasPage:
+                if (!inRange(entry.dataOffset, pixelBytes, fileSize)) return false;
+                break;
+            case AssetPack::Kind::Overlay:
+                if (!inRange(entry.dataOffset, pixelBytes, fileSize)) return false;
+                if (entry.zonesOffset % alignof(AssetPack::Zone) != 0) return false;
+                if (!inRange(entry.zonesOffset, entry.zoneCount * sizeof(AssetPack::Zone)
+                    + static_cast<std::uint64_t>(entry.width) * entry.height * sizeof(std::uint32_t), fileSize)) return false;
+                break;
+            case AssetPack::Kind::AtlasRegion: {
+                if (entry.page >= count || entries[entry.page].kind != AssetPack::Kind::AtlasPage) return false;
+                const AssetPack::Entry& page = entries[entry.page];
+                if (entry.left < 0 || entry.top < 0
+                    || static_cast<std::uint64_t>(entry.left) + entry.width > page.width
+                    || static_cast<std::uint64_t>(entry.top) + entry.height > page.height) return false;
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// 64-bit FNV-1a
+std::uint64_t AssetPack::hash(const void* data, size_t length, std::uint64_t seed) {
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    std::uint64_t h = seed;
+    for (size_t i = 0; i < length; ++i) {
+        h ^= bytes[i];
+        h *= 0x100000001B3ull;
+    }
+    return h;
+}
+
+bool AssetPack::open(const std::string& path) {
+    close();
+
+    size_t mappedSize = 0;
+    const std::uint8_t* data = mapFile(path, mappedSize);
+    if (!data) {
+        LOG_INFO(Resources, "No asset pack, loading loose files", { { "path", path } });
+        return false;
+    }
+
+    Header header;
+    bool valid = mappedSize >= sizeof(Header);
+    if (valid) {
+        std::memcpy(&header, data, sizeof(Header));
+        valid = header.magic == MAGIC && header.version == VERSION && header.fileSize == mappedSize
+            && header.entriesOffset % alignof(Entry) == 0
+            && inRange(header.entriesOffset, static_cast<std::uint64_t>(header.entryCount) * sizeof(Entry), mappedSize);
+    }
+    if (valid) {
+        valid = validateEntries(reinterpret_cast<const Entry*>(data + header.entriesOffset), header.entryCount, mappedSize);
+    }
+
+    if (!valid) {
+        LOG_WARN(Resources, "Ignoring invalid or outdated asset pack", { { "path", path } });
+        unmapFile(data, mappedSize);
+        return false;
+    }
+
+    base = data;
+    size = mappedSize;
+    entries = reinterpret_cast<const Entry*>(data + header.entriesOffset);
+    entryCount = header.entryCount;
+
+    LOG_INFO(Resources, "Mapped asset pack", { { "path", path }, { "entries", entryCount }, { "bytes", size } });
+    return true;
+}
+
+void AssetPack::close() {
+    if (!base) return;
+
+    unmapFile(base, size);
+    base = nullptr;
+    size = 0;
+    entries = nullptr;
+    entryCount = 0;
+}
+
+// Binary search the hash-sorted index, then compare names to rule out collisions
+const AssetPack::Entry* AssetPack::find(const std::string& name) {
+    if (!base) return nullptr;
+
+    const std::uint64_t nameHash = hash(name.data(), name.size());
+    const Entry* end = entries + entryCount;
+    const Entry* it = std::lower_bound(entries, end, nameHash,
+        [](const Entry& entry, std::uint64_t value) { return entry.nameHash < value; });
+
+    for (; it != end && it->nameHash == nameHash; ++it) {
+        if (it->nameLength == name.size() && std::memcmp(base + it->nameOffset, name.data(), name.size()) == 0) {
+            return it;
+        }
+    }
+    return nullptr;
+}
+
+const AssetPack::Entry* AssetPack::getEntry(std::uint32_t index) {
+    return index < entryCount ? &entries[index] : nullptr;
+}
+
+const std::uint8_t* AssetPack::getPixels(const Entry& entry) {
+    if (entry.kind == Kind::AtlasRegion) {
+        const Entry& page = entries[entry.page];
+        return base + page.dataOffset + (static_cast<size_t>(entry.top) * page.width + entry.left) * 4;
+    }
+    return base + entry.dataOffset;
+}
+
+size_t AssetPack::getStride(const Entry& entry) {
+    const std::uint32_t width = entry.kind == Kind::AtlasRegion ? entries[entry.page].width : entry.width;
+    return static_cast<size_t>(width) * 4;
+}
+
+const AssetPack::Zone* AssetPack::getZones(const Entry& entry) {
+    return reinterpret_cast<const Zone*>(base + entry.zonesOffset);
+}
+
+const std::uint32_t* AssetPack::getLabels(const Entry& entry) {
+    return reinterpret_cast<const std::uint32_t*>(base + entry.zonesOffset + entry.zoneCount * sizeof(Zone));
+}
+
+bool AssetPack::isFresh(const Entry& entry, const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return true;   // Pack-only install
+
+    std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return hash(contents.data(), contents.size()) == entry.sourceHash;
+}
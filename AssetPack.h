@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "ZoneDetector.h"
+
+// Read-only view of a baked asset pack (see tools/AssetBaker.cpp), memory-mapped so textures
+// upload straight from the mapped pixels with no decode step.
+//
+// File layout (little-endian, every block 16-byte aligned):
+//   Header | entries sorted by nameHash | name strings | data blocks
+// Entries are keyed by the source file path the game would otherwise load. Each records a hash
+// of that file's contents, so a pack older than its loose files is detected and skipped.
+class AssetPack {
+public:
+    static constexpr std::uint32_t MAGIC = 0x4B505253;   // "SRPK"
+    static constexpr std::uint32_t VERSION = 1;
+
+    enum class Kind : std::uint32_t {
+        Image,         // RGBA pixels
+        Overlay,       // RGBA pixels, zone table and zone label map of a scratch overlay
+        AtlasPage,     // RGBA pixels of a packed atlas page
+        AtlasRegion    // Sub-rect of an atlas page; pixels are read in place from the page
+    };
+
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t reserved;
+        std::uint64_t entriesOffset;
+        std::uint64_t fileSize;
+    };
+
+    struct Entry {
+        std::uint64_t nameHash;       // hash() of the name
+        std::uint64_t sourceHash;     // hash() of the source file contents (0 for atlas pages)
+        std::uint64_t dataOffset;     // Pixels (Image, Overlay, AtlasPage)
+        std::uint64_t zonesOffset;    // Overlay: zoneCount zone records, then width * height uint32 labels
+        std::uint32_t nameOffset;
+        std::uint32_t nameLength;
+        Kind kind;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t zoneCount;
+        std::uint32_t page;           // AtlasRegion: index of its AtlasPage entry
+        std::int32_t left;            // AtlasRegion: position on the page
+        std::int32_t top;
+        std::uint32_t reserved;
+    };
+
+    // Zone record as stored in the pack (matches ZoneDetector::Zone)
+    struct Zone {
+        std::int32_t left;
+        std::int32_t top;
+        std::int32_t width;
+        std::int32_t height;
+        std::int32_t pixelCount;
+    };
+
+    // 64-bit FNV-1a, used for names and source contents
+    static std::uint64_t hash(const void* data, size_t length, std::uint64_t seed = 0xCBF29CE484222325ull);
+
+    // Map a pack file; returns false (and keeps using loose files) if it is missing or invalid
+    static bool open(const std::string& path);
+
+    // Unmap the pack; pointers into it become invalid
+    static void close();
+
+    static bool isOpen() { return base != nullptr; }
+
+    // Entry for a name (source file path), or nullptr
+    static const Entry* find(const std::string& name);
+
+    // Entry by index, for atlas pages
+    static const Entry* getEntry(std::uint32_t index);
+
+    // RGBA pixels of an entry and the bytes between rows (AtlasRegion entries point into their page)
+    static const std::uint8_t* getPixels(const Entry& entry);
+    static size_t getStride(const Entry& entry);
+
+    // Overlay zone table and row-major zone labels
+    static const Zone* getZones(const Entry& entry);
+    static const std::uint32_t* getLabels(const Entry& entry);
+
+    // True if the entry can stand in for the loose file at path: the file is missing
+    // (pack-only install) or its contents still hash to the baked sourceHash
+    static bool isFresh(const Entry& entry, const std::string& path);
+
+private:
+    static const std::uint8_t* base;
+    static size_t size;
+    static const Entry* entries;
+    static std::uint32_t entryCount;
+};
+
+static_assert(sizeof(AssetPack::Header) == 32, "AssetPack::Header layout");
+static_assert(sizeof(AssetPack::Entry) == 72, "AssetPack::Entry layout");
+static_assert(sizeof(AssetPack::Zone) == sizeof(ZoneDetector::Zone), "AssetPack::Zone must match ZoneDetector::Zone");
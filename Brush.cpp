@@ -0,0 +1,36 @@
+#include "Brush.h"
+
+#include <algorithm>
+
+// Build a brush; circle and rough shapes copy their rows from the compile-time tables when possible
+Brush::Brush(BrushShape shape, int radius)
+    : shape(shape), radius(std::max(1, radius))
+{
+    rows.resize(2 * this->radius + 1);
+    const int r = this->radius;
+
+    switch (shape) {
+    case BrushShape::Square:
+        std::fill(rows.begin(), rows.end(), BrushSpan{ -r, r + 1 });
+        break;
+
+    case BrushShape::Rough:
+        if (r <= BrushTables::MAX_TABLE_RADIUS) {
+            std::copy_n(BrushTables::ROUGH[r].begin(), rows.size(), rows.begin());
+        }
+        else {
+            for (int dy = -r; dy <= r; ++dy) rows[dy + r] = BrushTables::roughRow(r, dy);
+        }
+        break;
+
+    case BrushShape::Circle:
+    default:
+        if (r <= BrushTables::MAX_TABLE_RADIUS) {
+            std::copy_n(BrushTables::CIRCLE[r].begin(), rows.size(), rows.begin());
+        }
+        else {
+            for (int dy = -r; dy <= r; ++dy) rows[dy + r] = BrushTables::circleRow(r, dy);
+        }
+        break;
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <array>
+#include <vector>
+
+// Footprint shapes available to scratch tools
+enum class BrushShape {
+    Circle,
+    Square,
+    Rough     // Circle with jagged, deterministic edges
+};
+
+// One row of a brush footprint: pixels [start, end) relative to the brush center
+struct BrushSpan {
+    int start = 0;
+    int end = 0;
+};
+
+// Compile-time span tables for the brush radii that come up in play (baseRadius / scale)
+namespace BrushTables {
+    // Largest radius with a precomputed table; larger brushes are generated at runtime
+    constexpr int MAX_TABLE_RADIUS = 16;
+
+    using Table = std::array<BrushSpan, 2 * MAX_TABLE_RADIUS + 1>;
+
+    // Integer square root (floor)
+    constexpr int isqrt(int n) {
+        int root = 0;
+        while ((root + 1) * (root + 1) <= n) ++root;
+        return root;
+    }
+
+    // Row spans of a filled circle: pixel (dx, dy) is inside when dx*dx + dy*dy <= r*r
+    constexpr BrushSpan circleRow(int radius, int dy) {
+        const int halfWidth = isqrt(radius * radius - dy * dy);
+        return { -halfWidth, halfWidth + 1 };
+    }
+
+    // Amount to shave off one end of a rough brush row (stable hash of radius, row and side)
+    constexpr int roughInset(int radius, int dy, int side) {
+        unsigned int h = static_cast<unsigned int>(radius) * 73856093u
+            ^ static_cast<unsigned int>(dy + radius) * 19349663u
+            ^ static_cast<unsigned int>(side) * 83492791u;
+        h ^= h >> 13;
+        h *= 0x5bd1e995u;
+        h ^= h >> 15;
+        const int maxInset = radius / 4 + 1;
+        return static_cast<int>(h % static_cast<unsigned int>(maxInset + 1));
+    }
+
+    // Rough rows: circle rows with each end pulled in by a small jitter; the center row stays whole
+    constexpr BrushSpan roughRow(int radius, int dy) {
+        BrushSpan span = circleRow(radius, dy);
+        if (dy == 0) return span;
+
+        span.start += roughInset(radius, dy, 0);
+        span.end -= roughInset(radius, dy, 1);
+        if (span.start >= span.end) span.end = span.start + 1;
+        return span;
+    }
+
+    constexpr std::array<Table, MAX_TABLE_RADIUS + 1> makeTables(bool rough) {
+        std::array<Table, MAX_TABLE_RADIUS + 1> tables{};
+        for (int radius = 1; radius <= MAX_TABLE_RADIUS; ++radius) {
+            for (int dy = -radius; dy <= radius; ++dy) {
+                tables[radius][dy + radius] = rough ? roughRow(radius, dy) : circleRow(radius, dy);
+            }
+        }
+        return tables;
+    }
+
+    inline constexpr std::array<Table, MAX_TABLE_RADIUS + 1> CIRCLE = makeTables(false);
+    inline constexpr std::array<Table, MAX_TABLE_RADIUS + 1> ROUGH = makeTables(true);
+}
+
+// A brush footprint stored as one span per row, rows -radius..radius
+class Brush {
+public:
+    Brush() = default;
+
+    // Build a brush; circle and rough shapes copy their rows from the compile-time tables when possible
+    Brush(BrushShape shape, int radius);
+
+    BrushShape getShape() const { return shape; }
+    int getRadius() const { return radius; }
+
+    // Span for row offset dy in [-radius, radius]
+    const BrushSpan& row(int dy) const { return rows[dy + radius]; }
+
+private:
+    BrushShape shape = BrushShape::Circle;
+    int radius = 0;
+    std::vector<BrushSpan> rows;
+};
+
+// Scratch tools the player can switch between; radius is in screen pixels before card scale
+struct BrushPreset {
+    const char* name;
+    BrushShape shape;
+    int baseRadius;
+};
+
+inline constexpr std::array<BrushPreset, 4> BRUSH_PRESETS = { {
+    { "Coin", BrushShape::Circle, 8 },
+    { "Big Coin", BrushShape::Circle, 16 },
+    { "Scraper", BrushShape::Square, 12 },
+    { "Key", BrushShape::Rough, 12 },
+} };
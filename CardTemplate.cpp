@@ -0,0 +1,80 @@
+#include "CardTemplate.h"
+#include "AssetPack.h"
+#include "Log.h"
+
+#include <algorithm>
+
+// Static member definitions
+std::map<std::pair<std::string, std::string>, std::shared_ptr<const CardTemplate>> CardTemplate::cache;
+
+// Return the template for this card/overlay pair, loading it on first use
+std::shared_ptr<const CardTemplate> CardTemplate::get(const std::string& cardPath, const std::string& overlayPath) {
+    auto key = std::make_pair(cardPath, overlayPath);
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    std::shared_ptr<const CardTemplate> loaded(new CardTemplate(cardPath, overlayPath));
+    cache.emplace(std::move(key), loaded);
+    return loaded;
+}
+
+// Drop all cached templates (cards still holding one keep it alive)
+void CardTemplate::clearCache() {
+    cache.clear();
+}
+
+std::shared_ptr<const CardTemplate> CardTemplate::fromOverlay(const sf::Image& overlay) {
+    std::shared_ptr<CardTemplate> made(new CardTemplate());
+    made->overlayImage = overlay;
+
+    const sf::Vector2u size = made->overlayImage.getSize();
+    made->layout = CardLayout::fromOverlay(made->overlayImage.getPixelsPtr(), size.x, size.y);
+    return made;
+}
+
+// Load both images and build the card layout from the overlay.
+// Fresh asset pack entries are used as is: no decode, and no zone detection for the overlay.
+CardTemplate::CardTemplate(const std::string& cardPath, const std::string& overlayPath) {
+    const AssetPack::Entry* bakedCard = AssetPack::find(cardPath);
+    if (bakedCard && bakedCard->kind == AssetPack::Kind::Image && AssetPack::isFresh(*bakedCard, cardPath)) {
+        if (cardTexture.create(bakedCard->width, bakedCard->height)) {
+            cardTexture.update(AssetPack::getPixels(*bakedCard));
+        }
+    }
+    else if (!cardTexture.loadFromFile(cardPath)) {
+        LOG_ERROR(Resources, "Failed to load card texture", { { "path", cardPath } });
+    }
+    cardTexture.setSmooth(false);
+
+    const AssetPack::Entry* bakedOverlay = AssetPack::find(overlayPath);
+    if (bakedOverlay && bakedOverlay->kind == AssetPack::Kind::Overlay && AssetPack::isFresh(*bakedOverlay, overlayPath)) {
+        const unsigned int width = bakedOverlay->width;
+        const unsigned int height = bakedOverlay->height;
+        overlayImage.create(width, height, AssetPack::getPixels(*bakedOverlay));
+
+        // Labels index the zone table, so one past zoneCount would write outside it; such a pack is rebuilt from the file
+        const std::uint32_t* labels = AssetPack::getLabels(*bakedOverlay);
+        const std::uint32_t* labelsEnd = labels + static_cast<size_t>(width) * height;
+        const std::uint32_t zoneCount = bakedOverlay->zoneCount;
+        if (std::all_of(labels, labelsEnd, [zoneCount](std::uint32_t label) { return label <= zoneCount; })) {
+            const AssetPack::Zone* bakedZones = AssetPack::getZones(*bakedOverlay);
+            std::vector<ZoneDetector::Zone> zones(zoneCount);
+            for (size_t i = 0; i < zones.size(); ++i) {
+                zones[i] = { bakedZones[i].left, bakedZones[i].top, bakedZones[i].width, bakedZones[i].height, bakedZones[i].pixelCount };
+            }
+
+            layout = CardLayout::fromZones(overlayImage.getPixelsPtr(), width, height,
+                std::move(zones), std::vector<std::uint32_t>(labels, labelsEnd));
+            return;
+        }
+        LOG_WARN(Resources, "Baked overlay has labels outside its zones, loading from file", { { "path", overlayPath } });
+    }
+
+    if (!overlayImage.loadFromFile(overlayPath)) {
+        LOG_ERROR(Resources, "Failed to load card overlay", { { "path", overlayPath } });
+    }
+
+    layout = CardLayout::fromOverlay(overlayImage.getPixelsPtr(), overlayImage.getSize().x, overlayImage.getSize().y);
+}
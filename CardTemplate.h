@@ -0,0 +1,47 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ScratchCardModel.h"
+
+// Immutable data shared by every scratch card built from the same card and overlay images:
+// the card texture, the decoded overlay and the card layout (zones and scratch mask layout).
+// Each pair is loaded and labeled once and cached; cards keep a shared pointer to it
+// and only own their per-instance mask, overlay pixels and prizes.
+class CardTemplate {
+public:
+    // Return the template for this card/overlay pair, loading it on first use
+    static std::shared_ptr<const CardTemplate> get(const std::string& cardPath, const std::string& overlayPath);
+
+    // Drop all cached templates (cards still holding one keep it alive)
+    static void clearCache();
+
+    // Build an uncached template around an overlay already in memory (generated overlays, tools).
+    // The card texture is left empty.
+    static std::shared_ptr<const CardTemplate> fromOverlay(const sf::Image& overlay);
+
+    const sf::Texture& getCardTexture() const { return cardTexture; }
+    const sf::Image& getOverlayImage() const { return overlayImage; }
+
+    unsigned int getOverlayWidth() const { return overlayImage.getSize().x; }
+    unsigned int getOverlayHeight() const { return overlayImage.getSize().y; }
+
+    // Zones and mask layout for building card models
+    const std::shared_ptr<const CardLayout>& getLayout() const { return layout; }
+
+private:
+    // Load both images and build the card layout from the overlay
+    CardTemplate(const std::string& cardPath, const std::string& overlayPath);
+    CardTemplate() = default;
+
+    sf::Texture cardTexture;       // Card base texture
+    sf::Image overlayImage;        // Decoded overlay (alpha defines the scratchable zones)
+
+    std::shared_ptr<const CardLayout> layout;
+
+    // Loaded templates keyed by (card path, overlay path)
+    static std::map<std::pair<std::string, std::string>, std::shared_ptr<const CardTemplate>> cache;
+};
@@ -0,0 +1,63 @@
+#include "Catalog.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // Name <-> dense index table for one kind of item
+    struct NameTable {
+        std::unordered_map<std::string, std::uint32_t> indices;
+        std::vector<std::string> names;
+
+        std::uint32_t intern(const std::string& name) {
+            auto it = indices.find(name);
+            if (it != indices.end()) return it->second;
+
+            const std::uint32_t index = static_cast<std::uint32_t>(names.size());
+            indices.emplace(name, index);
+            names.push_back(name);
+            return index;
+        }
+
+        const std::string& name(std::uint32_t index) const {
+            static const std::string empty;
+            return index < names.size() ? names[index] : empty;
+        }
+    };
+
+    NameTable& cards() {
+        static NameTable table;
+        return table;
+    }
+
+    NameTable& relics() {
+        static NameTable table;
+        return table;
+    }
+}
+
+namespace Catalog {
+    CardId cardId(const std::string& name) {
+        return { cards().intern(name) };
+    }
+
+    RelicId relicId(const std::string& name) {
+        return { relics().intern(name) };
+    }
+
+    const std::string& cardName(CardId id) {
+        return cards().name(id.index);
+    }
+
+    const std::string& relicName(RelicId id) {
+        return relics().name(id.index);
+    }
+
+    std::uint32_t getCardCount() {
+        return static_cast<std::uint32_t>(cards().names.size());
+    }
+
+    std::uint32_t getRelicCount() {
+        return static_cast<std::uint32_t>(relics().names.size());
+    }
+}
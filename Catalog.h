@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// Interned card ID: a dense index into the catalog, so inventories can be flat arrays
+struct CardId {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;
+    std::uint32_t index = INVALID;
+
+    bool isValid() const { return index != INVALID; }
+    bool operator==(CardId other) const { return index == other.index; }
+    bool operator!=(CardId other) const { return index != other.index; }
+};
+
+// Interned relic ID (see CardId)
+struct RelicId {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;
+    std::uint32_t index = INVALID;
+
+    bool isValid() const { return index != INVALID; }
+    bool operator==(RelicId other) const { return index == other.index; }
+    bool operator!=(RelicId other) const { return index != other.index; }
+};
+
+// Registry of every card and relic ID seen this run. Names are interned on first use and keep
+// their index for the rest of the run; indices are handed out in order from 0 with no gaps.
+// Intern once (at load or purchase time) and pass the handles around in per-frame and per-card code.
+namespace Catalog {
+    CardId cardId(const std::string& name);
+    RelicId relicId(const std::string& name);
+
+    // Name of an interned ID; empty for invalid or unknown IDs
+    const std::string& cardName(CardId id);
+    const std::string& relicName(RelicId id);
+
+    // Number of IDs interned so far (one past the largest index)
+    std::uint32_t getCardCount();
+    std::uint32_t getRelicCount();
+}
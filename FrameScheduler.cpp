@@ -0,0 +1,44 @@
+#include "FrameScheduler.h"
+
+#include <cstdlib>
+#include <cstring>
+
+FrameSettings FrameSettings::fromEnvironment() {
+    FrameSettings settings;
+
+    if (const char* env = std::getenv("SCRATCH_FPS")) {
+        if (std::strcmp(env, "vsync") == 0) {
+            settings.pacing = FramePacing::VSync;
+        }
+        else {
+            const unsigned long limit = std::strtoul(env, nullptr, 10);
+            settings.pacing = (limit == 0) ? FramePacing::Unlimited : FramePacing::Capped;
+            settings.frameRateLimit = static_cast<unsigned int>(limit);
+        }
+    }
+
+    if (const char* env = std::getenv("SCRATCH_IDLE")) {
+        settings.idleRendering = std::strcmp(env, "0") != 0;
+    }
+
+    return settings;
+}
+
+FrameScheduler::FrameScheduler(float step, int maxStepsPerFrame)
+    : step(step), maxStepsPerFrame(maxStepsPerFrame) {}
+
+int FrameScheduler::advance(float elapsedSeconds) {
+    if (elapsedSeconds > 0.f) accumulator += elapsedSeconds;
+
+    int steps = 0;
+    while (accumulator >= step && steps < maxStepsPerFrame) {
+        accumulator -= step;
+        ++steps;
+    }
+
+    // Too far behind to catch up: drop the backlog instead of spiralling
+    if (accumulator >= step) accumulator = 0.f;
+
+    stepCount += static_cast<std::uint64_t>(steps);
+    return steps;
+}
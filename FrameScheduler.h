@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+
+// How rendered frames are paced against the display
+enum class FramePacing {
+    VSync,      // Block on the display refresh
+    Capped,     // Sleep to hold frameRateLimit
+    Unlimited   // Render as fast as possible
+};
+
+// Frame loop configuration, read from the environment so a run can be tuned without rebuilding:
+//   SCRATCH_FPS   "vsync", "0" (unlimited) or a frame cap such as "144"; default is a 60 fps cap
+//   SCRATCH_IDLE  "0" keeps rendering while nothing changes on screen; default is idle rendering on
+struct FrameSettings {
+    FramePacing pacing = FramePacing::Capped;
+    unsigned int frameRateLimit = 60;
+    bool idleRendering = true;
+
+    static FrameSettings fromEnvironment();
+};
+
+// Fixed-step simulation clock. Real frame time is accumulated and spent in whole steps
+// of getStep() seconds, so game logic sees the same dt on every machine and frame rate;
+// the leftover fraction is exposed for interpolating between the last two steps when drawing.
+class FrameScheduler {
+public:
+    // step: simulation step in seconds; maxStepsPerFrame: catch-up limit after a long stall
+    explicit FrameScheduler(float step = 1.f / 120.f, int maxStepsPerFrame = 8);
+
+    // Add elapsed real time and return how many simulation steps to run this frame.
+    // Time beyond maxStepsPerFrame steps is dropped rather than carried over.
+    int advance(float elapsedSeconds);
+
+    // Forget accumulated time, e.g. after sleeping while idle
+    void reset() { accumulator = 0.f; }
+
+    float getStep() const { return step; }
+
+    // Fraction of a step accumulated past the last simulated one, in [0, 1)
+    float getInterpolation() const { return accumulator / step; }
+
+    // Total simulation steps run since construction
+    std::uint64_t getStepCount() const { return stepCount; }
+
+private:
+    float step;
+    int maxStepsPerFrame;
+    float accumulator = 0.f;
+    std::uint64_t stepCount = 0;
+};
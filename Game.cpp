@@ -1,229 +1,330 @@
 #include "Game.h"
+#include "AssetPack.h"
 #include "ResourceManager.h"
+#include "Random.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <algorithm>
 #include <cmath>
 #include <memory>
-#include <iostream>
 
 namespace {
     constexpr unsigned int DEFAULT_WIDTH = 1280;
     constexpr unsigned int DEFAULT_HEIGHT = 720;
     constexpr float GAME_PIXEL_SCALE = 3.f;
+
+    // Cards built ahead of the one being scratched
+    constexpr size_t CARDS_PREPARED_AHEAD = 2;
+
+    // Texture bytes uploaded per frame while loading
+    constexpr size_t TEXTURE_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+    // Frames captured by the F4 profiler trace
+    constexpr std::uint64_t TRACE_FRAMES = 120;
+
+    // Scratch dust lifetime and gravity
+    constexpr float DUST_LIFETIME = 0.5f;
+    constexpr float DUST_GRAVITY = 200.f;
 }
 
 Game::Game()
     : window(sf::VideoMode(DEFAULT_WIDTH, DEFAULT_HEIGHT), "Scratch Card Roguelike", sf::Style::Default),
-    currentState(GameState::SHOP),
+    currentState(GameState::LOADING),
     windowScale(1.f),
     offsetX(0.f),
     offsetY(0.f),
     currentCardIndex(0),
     cardProcessed(false)
 {
+    // Seed every random stream for this run; the seed is printed so a run can be replayed via SCRATCH_SEED
+    Random::setRunSeed(Random::makeSeed());
+    LOG_INFO(Game, "Run seed", { { "seed", Random::getRunSeed() } });
+
     loadResources();
 
+    virtualCanvas.create(DEFAULT_WIDTH, DEFAULT_HEIGHT);
+    virtualCanvas.setSmooth(false);
+
+    finalSprite.setTexture(virtualCanvas.getTexture());
+    finalSprite.setTextureRect({ 0, 0, static_cast<int>(DEFAULT_WIDTH), static_cast<int>(DEFAULT_HEIGHT) });
+
+    // Intern per-frame resources once; the handles resolve as the textures finish loading
+    mainFontId = ResourceManager::fontId("mainFont");
+    dustTextureId = ResourceManager::textureId("dust");
+    cardPreviewTextureId = ResourceManager::textureId("lucky_7_shop");
+    lucky7CardId = Catalog::cardId("lucky_7_shop");
+
+    // Setup text UI elements
+    hud.setFont(ResourceManager::getFont(mainFontId), static_cast<unsigned int>(12 * GAME_PIXEL_SCALE));
+    ownedCardsCountText.setFont(ResourceManager::getFont(mainFontId));
+    ownedCardsCountText.setCharacterSize(static_cast<unsigned int>(14 * GAME_PIXEL_SCALE));
+    ownedCardsCountText.setFillColor(sf::Color::White);
+
+    frameSettings = FrameSettings::fromEnvironment();
+    applyFramePacing();
+    Profiler::configureFromEnvironment();
+
+    deltaClock.restart();
+    updateWindowScale();
+}
+
+void Game::run() {
+    while (window.isOpen()) {
+        // Nothing would change on screen: sleep until an event that needs a new frame
+        if (frameSettings.idleRendering && !redrawRequested && deferredEvents.empty() && !isAnimating()) {
+            waitForRedraw();
+            if (!window.isOpen()) break;
+        }
+
+        Profiler::beginFrame();
+        {
+            PROFILE_ZONE("Game::processEvents");
+            processEvents();
+        }
+
+        // Simulate in fixed steps, then draw once for however much real time has passed.
+        // Each step takes the pointer samples up to its own end time, counted back from now.
+        const int steps = scheduler.advance(deltaClock.restart().asSeconds());
+        const std::int64_t inputTime = pointerInput.now();
+        const std::int64_t stepMicroseconds = static_cast<std::int64_t>(scheduler.getStep() * 1e6f);
+        for (int i = 0; i < steps; ++i) {
+            update(scheduler.getStep(), inputTime - (steps - 1 - i) * stepMicroseconds);
+        }
+
+        // The upload budget is per rendered frame, however many steps ran
+        if (currentState == GameState::LOADING) {
+            uploadLoadedTextures();
+        }
+
+        render();
+        redrawRequested = false;
+        Profiler::endFrame();
+    }
+
+    ResourceManager::reportStringLookups();
+}
+
+void Game::loadResources() {
+    // Pre-decoded pixels and zone tables from tools/AssetBaker; loose files are used when it is missing or stale
+    AssetPack::open("assets/assets.pack");
+
+    // The font is needed for the loading screen itself
+    ResourceManager::loadFont("mainFont", "assets/fonts/retro.ttf");
+
+    // Textures used throughout the game decode in parallel; uploadLoadedTextures() uploads them as they arrive, once per frame.
+    // Small sprites, icons and symbols (atlas = true) share atlas pages; draw them via getRegion/setSpriteTexture.
+    ResourceManager::loadTexturesAsync({
+        { "dust", "assets/sprites/dust.png", true },
+        { "shop_bg", "assets/sprites/shop_bg.png" },
+        { "reroll_button", "assets/sprites/reroll_button.png", true },
+        { "next_round_button", "assets/sprites/next_round_button.png", true },
+        { "relic_1", "assets/sprites/relic_1.png", true },
+        { "relic_2", "assets/sprites/relic_2.png", true },
+        { "card_shop", "assets/sprites/card_shop.png", true },
+
+        { "lucky_7", "assets/sprites/lucky_7.png" },
+        { "lucky_7_shop", "assets/sprites/lucky_7_shop.png", true },
+
+        { "empty", "assets/sprites/symbols/empty.png", true },
+        { "7", "assets/sprites/symbols/7.png", true },
+        // Add more symbols here as needed
+    });
+    loadingClock.restart();
+}
+
+void Game::uploadLoadedTextures() {
+    // Upload whatever the decode workers have finished, within this frame's budget
+    ResourceManager::finalizeUploads(TEXTURE_UPLOAD_BUDGET);
+    if (ResourceManager::getLoadProgress().isDone()) {
+        finishLoading();
+    }
+}
+
+void Game::finishLoading() {
+    const LoadProgress progress = ResourceManager::getLoadProgress();
+    LOG_INFO(Resources, "Loading finished", { { "textures", progress.completed }, { "failed", progress.failed },
+        { "ms", loadingClock.getElapsedTime().asMilliseconds() }, { "sinceStartMs", Profiler::millisecondsSinceStart() } });
+
+    const TextureRegion dust = ResourceManager::getRegion(dustTextureId);
+    if (dust.texture) dustParticles.setTexture(*dust.texture, dust.rect);
+    dustParticles.setAcceleration(0.f, DUST_GRAVITY);
+
     shopView = std::make_unique<ShopView>();
+    shopView->setRelicPlan(&relicPlan);
 
     // Callback when next round button is clicked in shop view
     shopView->onNextRoundClicked = [this]() {
-        const auto& ownedCardCounts = player.getOwnedCardsCount();
-        if (ownedCardCounts.empty()) {
-            std::cout << "You must buy at least one card before starting the round!\n";
+        if (player.getCardTotal() == 0) {
+            LOG_INFO(Game, "You must buy at least one card before starting the round");
             return;
         }
 
         // Initialize round parameters
         roundEarnings = 0;
-        quota = 50 + (currentRound - 1) * 20;
+        relicPlan.update(player);
+        quota = relicPlan.getQuota(50 + (currentRound - 1) * 20);
         gameOver = false;
 
         // Build list of cards to scratch (repeat by count)
         ownedCardsToScratch.clear();
-        for (const auto& [cardId, count] : ownedCardCounts) {
+        ownedCardsToScratch.reserve(player.getCardTotal());
+        for (CardId card : player.getOwnedCards()) {
+            const int count = player.getCardCount(card);
             for (int i = 0; i < count; ++i) {
-                ownedCardsToScratch.push_back(cardId);
+                ownedCardsToScratch.push_back(card);
             }
         }
         currentCardIndex = 0;
         cardProcessed = false;
 
-        // DEBUG: Print owned cards to scratch
-        std::cout << "[Debug] Owned cards to scratch (" << ownedCardsToScratch.size() << "): ";
-        for (const auto& c : ownedCardsToScratch) std::cout << c << " ";
-        std::cout << std::endl;
+        LOG_DEBUG(Game, "Owned cards to scratch", { { "count", ownedCardsToScratch.size() } });
 
-        // Create ScratchCard instances for each card
+        // Only the first card is built now; the rest are built a frame or two before they are reached
         scratchCards.clear();
-        for (const auto& cardId : ownedCardsToScratch) {
-            auto sc = std::make_unique<ScratchCard>("assets/sprites/lucky_7.png", "assets/sprites/lucky_7_overlay.png", GAME_PIXEL_SCALE);
-            sc->loadCard(cardId);
-            sc->resetScratch();
-
-            sc->setPosition(
-                (DEFAULT_WIDTH - sc->getWidth()) / 2.f,
-                (DEFAULT_HEIGHT - sc->getHeight()) / 2.f
-            );
-
-            scratchCards.push_back(std::move(sc));
-        }
-
+        scratchCards.resize(ownedCardsToScratch.size());
         if (!scratchCards.empty()) {
+            prepareCard(0);
             currentState = GameState::SCRATCHING;
-            std::cout << "Starting scratch round with " << scratchCards.size() << " cards.\n";
+            LOG_INFO(Game, "Starting scratch round", { { "round", currentRound }, { "cards", scratchCards.size() } });
         }
         };
 
-    virtualCanvas.create(DEFAULT_WIDTH, DEFAULT_HEIGHT);
-    virtualCanvas.setSmooth(false);
-
-    finalSprite.setTexture(virtualCanvas.getTexture());
-    finalSprite.setTextureRect({ 0, 0, static_cast<int>(DEFAULT_WIDTH), static_cast<int>(DEFAULT_HEIGHT) });
-
-    // Setup text UI elements
-    const auto& mainFont = ResourceManager::getFont("mainFont");
+    currentState = GameState::SHOP;
+}
 
-    for (auto* textObj : { &balanceText, &winningsText, &quotaText, &roundEarningsText }) {
-        textObj->setFont(mainFont);
-        textObj->setCharacterSize(static_cast<unsigned int>(12 * GAME_PIXEL_SCALE));
+void Game::waitForRedraw() {
+    sf::Event event;
+    while (!redrawRequested && !isAnimating() && window.waitEvent(event)) {
+        handleEvent(event);
     }
 
-    balanceText.setFillColor(sf::Color::White);
-    winningsText.setFillColor(sf::Color::Yellow);
-    quotaText.setFillColor(sf::Color::Cyan);
-    roundEarningsText.setFillColor(sf::Color::Yellow);
-
+    // Time spent asleep is not simulated
     deltaClock.restart();
-    updateWindowScale();
+    scheduler.reset();
 }
 
-void Game::run() {
-    while (window.isOpen()) {
-        processEvents();
-        update(deltaClock.restart().asSeconds());
-        render();
+void Game::processEvents() {
+    // Events read while late-latching last frame come first, in arrival order
+    for (const sf::Event& deferred : deferredEvents) {
+        handleEvent(deferred);
+    }
+    deferredEvents.clear();
+
+    sf::Event event;
+    while (window.pollEvent(event)) {
+        handleEvent(event);
     }
 }
 
-void Game::loadResources() {
-    ResourceManager::loadFont("mainFont", "assets/fonts/retro.ttf");
+void Game::handleEvent(const sf::Event& event) {
+    // Nothing reacts to hovering, so plain mouse moves don't need a new frame
+    if (event.type != sf::Event::MouseMoved) redrawRequested = true;
 
-    // Load textures used throughout the game
-    ResourceManager::loadTexture("dust", "assets/sprites/dust.png");
-    ResourceManager::loadTexture("shop_bg", "assets/sprites/shop_bg.png");
-    ResourceManager::loadTexture("reroll_button", "assets/sprites/reroll_button.png");
-    ResourceManager::loadTexture("next_round_button", "assets/sprites/next_round_button.png");
-    ResourceManager::loadTexture("relic_1", "assets/sprites/relic_1.png");
-    ResourceManager::loadTexture("relic_2", "assets/sprites/relic_2.png");
-    ResourceManager::loadTexture("card_shop", "assets/sprites/card_shop.png");
-
-    ResourceManager::loadTexture("lucky_7", "assets/sprites/lucky_7.png");
-    ResourceManager::loadTexture("lucky_7_shop", "assets/sprites/lucky_7_shop.png");
-
-    ResourceManager::loadTexture("empty", "assets/sprites/symbols/empty.png");
-    ResourceManager::loadTexture("7", "assets/sprites/symbols/7.png");
-    // Add more symbols here as needed
-}
+    switch (event.type) {
+    case sf::Event::Closed:
+        window.close();
+        break;
 
-void Game::processEvents() {
-    sf::Event event;
-    while (window.pollEvent(event)) {
-        switch (event.type) {
-        case sf::Event::Closed:
+    case sf::Event::Resized:
+        updateWindowScale();
+        break;
+
+    case sf::Event::MouseMoved:
+        pointerInput.push((event.mouseMove.x - offsetX) / windowScale, (event.mouseMove.y - offsetY) / windowScale);
+        break;
+
+    case sf::Event::KeyPressed:
+        switch (event.key.code) {
+        case sf::Keyboard::Escape:
             window.close();
             break;
-
-        case sf::Event::Resized:
-            updateWindowScale();
+        case sf::Keyboard::F11:
+            toggleFullscreen();
             break;
-
-        case sf::Event::KeyPressed:
-            switch (event.key.code) {
-            case sf::Keyboard::Escape:
-                window.close();
-                break;
-            case sf::Keyboard::F11:
-                toggleFullscreen();
-                break;
-            case sf::Keyboard::M:
-                player.addBalance(10);
-                std::cout << "[Debug] Added 10 to player balance. New balance: " << player.getBalance() << "\n";
-                break;
-            case sf::Keyboard::A:
-                if (currentState == GameState::SCRATCHING && !scratchCards.empty()) {
-                    scratchCards[currentCardIndex]->startAutoScratch();
-                    std::cout << "Auto scratch started for current card.\n";
-                }
-                break;
-            default:
-                break;
-            }
+        case sf::Keyboard::F3:
+            profilerOverlay.toggle();
             break;
-
-        case sf::Event::MouseButtonPressed:
-            if (currentState == GameState::SHOP) {
-                auto mousePos = sf::Mouse::getPosition(window);
-                float x = (mousePos.x - offsetX) / windowScale;
-                float y = (mousePos.y - offsetY) / windowScale;
-                shopView->handleClick(x, y, player);
-            }
-            else if (currentState == GameState::SCRATCHING) {
-                isScratching = true;
-            }
+        case sf::Keyboard::F4:
+            // Capture the next couple of seconds of frames for chrome://tracing
+            Profiler::requestTrace(Profiler::getFrameIndex() + 1, TRACE_FRAMES, "trace.json");
+            LOG_INFO(Render, "Capturing profiler trace", { { "frames", TRACE_FRAMES } });
             break;
-
-        case sf::Event::MouseButtonReleased:
-            if (currentState == GameState::SCRATCHING) {
-                isScratching = false;
+        case sf::Keyboard::M:
+            player.addBalance(10);
+            LOG_DEBUG(Game, "Added 10 to player balance", { { "balance", player.getBalance() } });
+            break;
+        case sf::Keyboard::B:
+            // Cycle through scratch tools
+            brushPresetIndex = (brushPresetIndex + 1) % BRUSH_PRESETS.size();
+            LOG_INFO(Game, "Scratch tool", { { "tool", BRUSH_PRESETS[brushPresetIndex].name } });
+            break;
+        case sf::Keyboard::A:
+            if (currentState == GameState::SCRATCHING && !scratchCards.empty()) {
+                scratchCards[currentCardIndex]->startAutoScratch();
+                LOG_DEBUG(Game, "Auto scratch started for current card");
             }
             break;
-
         default:
             break;
         }
-    }
-}
+        break;
+
+    case sf::Event::MouseButtonPressed:
+        if (currentState == GameState::SHOP) {
+            auto mousePos = sf::Mouse::getPosition(window);
+            float x = (mousePos.x - offsetX) / windowScale;
+            float y = (mousePos.y - offsetY) / windowScale;
+            shopView->handleClick(x, y, player);
+        }
+        else if (currentState == GameState::SCRATCHING) {
+            // The stroke starts at the press; earlier hover samples are not part of it
+            isScratching = true;
+            pointerInput.clear();
+            pointerInput.push((event.mouseButton.x - offsetX) / windowScale, (event.mouseButton.y - offsetY) / windowScale);
+        }
+        break;
 
-void Game::update(float dt) {
-    if (currentState == GameState::SCRATCHING && isScratching && !scratchCards.empty()) {
-        auto mousePos = sf::Mouse::getPosition(window);
-        float virtualX = (mousePos.x - offsetX) / windowScale;
-        float virtualY = (mousePos.y - offsetY) / windowScale;
+    case sf::Event::MouseButtonReleased:
+        if (currentState == GameState::SCRATCHING) {
+            isScratching = false;
+            if (currentCardIndex < scratchCards.size()) {
+                scratchCards[currentCardIndex]->endStroke();
+            }
+        }
+        break;
 
-        if (scratchCards[currentCardIndex]->scratchAt(virtualX, virtualY, player)) {
-            // Create dust particle on scratching
-            Particle p;
-            p.sprite.setTexture(ResourceManager::getTexture("dust"));
-            p.sprite.setScale(GAME_PIXEL_SCALE * windowScale, GAME_PIXEL_SCALE * windowScale);
-            p.sprite.setPosition(virtualX, virtualY);
+    default:
+        break;
+    }
+}
 
-            p.velocity = sf::Vector2f(((rand() % 1000) / 1000.f - 0.5f) * 20.f, ((rand() % 500) / 1000.f) * -10.f);
-            p.acceleration = sf::Vector2f(0.f, 200.f);
-            p.lifetime = 0.5f;
+bool Game::isAnimating() const {
+    if (currentState == GameState::LOADING || dustParticles.size() > 0 || profilerOverlay.isVisible()) return true;
 
-            particles.push_back(std::move(p));
-        }
+    if (currentState == GameState::SCRATCHING && currentCardIndex < scratchCards.size() && scratchCards[currentCardIndex]) {
+        const ScratchCard& card = *scratchCards[currentCardIndex];
+        return isScratching || card.autoScratchActive || (card.isFullyRevealed() && !cardProcessed);
     }
+    return false;
+}
 
-    // Update particles and remove expired ones
-    for (auto it = particles.begin(); it != particles.end();) {
-        it->lifetime -= dt;
-        if (it->lifetime <= 0.f) {
-            it = particles.erase(it);
-        }
-        else {
-            it->velocity += it->acceleration * dt;
-            it->sprite.move(it->velocity * dt);
+void Game::update(float dt, std::int64_t inputTime) {
+    PROFILE_ZONE("Game::update");
+    // Nothing to simulate until loading finishes; uploads are driven per frame by uploadLoadedTextures
+    if (currentState == GameState::LOADING) return;
 
-            // Fade out particle alpha
-            sf::Color color = it->sprite.getColor();
-            color.a = static_cast<sf::Uint8>(255 * (it->lifetime / 0.5f));
-            it->sprite.setColor(color);
+    // Cheap unless the relic set changed since the last step
+    relicPlan.update(player);
 
-            ++it;
-        }
-    }
+    scratchAlongPointer(inputTime);
+
+    // Update particles and remove expired ones
+    dustParticles.update(dt);
 
     // Scratch card progression and logic
     if (currentState == GameState::SCRATCHING && !scratchCards.empty()) {
+        prepareUpcomingCards();
+
         // Auto scratch update
         scratchCards[currentCardIndex]->updateAutoScratch(dt, player);
 
@@ -242,9 +343,12 @@ void Game::update(float dt) {
                 player.useCard(ownedCardsToScratch[currentCardIndex]);
             }
             else {
-                std::cerr << "[Warning] Card index out of range in useCard.\n";
+                LOG_WARN(Game, "Card index out of range in useCard", { { "index", currentCardIndex } });
             }
 
+            // Scratched cards are never shown again; free their overlay pixels and texture
+            scratchCards[currentCardIndex].reset();
+
             // Advance to next card or end round
             currentCardIndex++;
 
@@ -258,16 +362,12 @@ void Game::update(float dt) {
                     currentState = GameState::SHOP;
                     shopActive = true;
                     shopView->reroll();
-                    std::cout << "Round complete! Moving to shop for round " << currentRound << ".\n";
+                    LOG_INFO(Game, "Round complete, moving to shop", { { "round", currentRound } });
                 }
             }
             else {
-                // Setup next card
-                scratchCards[currentCardIndex]->resetScratch();
-                scratchCards[currentCardIndex]->setPosition(
-                    (DEFAULT_WIDTH - scratchCards[currentCardIndex]->getWidth()) / 2.f,
-                    (DEFAULT_HEIGHT - scratchCards[currentCardIndex]->getHeight()) / 2.f
-                );
+                // Setup next card (normally already built ahead of time)
+                prepareCard(currentCardIndex);
                 cardProcessed = false;
             }
         }
@@ -277,13 +377,60 @@ void Game::update(float dt) {
     }
 }
 
+void Game::scratchAlongPointer(std::int64_t until) {
+    pointerPath.clear();
+    pointerInput.drainUntil(until, pointerPath);
+    if (pointerPath.empty() || currentState != GameState::SCRATCHING || !isScratching) return;
+    if (currentCardIndex >= scratchCards.size() || !scratchCards[currentCardIndex]) return;
+
+    auto& card = scratchCards[currentCardIndex];
+    const BrushPreset& tool = BRUSH_PRESETS[brushPresetIndex];
+    card->setBrush(tool.shape, tool.baseRadius);
+
+    // Sweep the brush through every sample so fast drags follow the real path and leave no gaps
+    const PointerSample* lastScratched = nullptr;
+    for (const PointerSample& sample : pointerPath) {
+        const bool scratched = card->isStrokeActive()
+            ? card->extendStroke(sample.x, sample.y, player)
+            : card->beginStroke(sample.x, sample.y, player);
+        if (scratched) lastScratched = &sample;
+    }
+
+    // One dust particle per step at most, however many samples the mouse delivered
+    if (lastScratched) {
+        dustParticles.emit(lastScratched->x, lastScratched->y, 1, DUST_LIFETIME, Random::particles());
+    }
+}
+
+void Game::latchPointerInput() {
+    PROFILE_ZONE("Game::latchPointerInput");
+    sf::Event event;
+    while (window.pollEvent(event)) {
+        // Only moves that precede every other pending event can be applied early without reordering input
+        if (deferredEvents.empty() && event.type == sf::Event::MouseMoved) {
+            handleEvent(event);
+        }
+        else {
+            deferredEvents.push_back(event);
+        }
+    }
+    scratchAlongPointer(pointerInput.now());
+}
+
 void Game::render() {
+    PROFILE_ZONE("Game::render");
+    overlayBytesUploadedThisFrame = 0;
+    spriteBatch.resetStats();
+
     // Clear with different background color depending on state
     virtualCanvas.clear(currentState == GameState::SHOP ? sf::Color(30, 30, 30) : sf::Color(50, 50, 50));
 
-    if (currentState == GameState::SHOP) {
-        particles.clear();
-        shopView->draw(virtualCanvas);
+    if (currentState == GameState::LOADING) {
+        drawLoadingScreen(virtualCanvas);
+    }
+    else if (currentState == GameState::SHOP) {
+        dustParticles.clear();
+        shopView->draw(virtualCanvas, spriteBatch);
         drawOwnedCards(virtualCanvas);
     }
     else if (currentState == GameState::SCRATCHING) {
@@ -294,35 +441,30 @@ void Game::render() {
                 (DEFAULT_HEIGHT - sc->getHeight()) / 2.f
             );
 
-            sc->drawBase(virtualCanvas);
-            sc->drawPrizes(virtualCanvas);
-
-            // Draw multiplier texts
-            const sf::Font& font = ResourceManager::getFont("mainFont");
-            for (const auto& info : sc->getRevealedPrizeTexts()) {
-                sf::Text text(info.text, font, static_cast<unsigned int>(6 * GAME_PIXEL_SCALE));
-                text.setFillColor(sf::Color::Black);
+            // Scratch up to the newest mouse position before anything of the card is drawn
+            latchPointerInput();
 
-                sf::FloatRect bounds = text.getLocalBounds();
-                text.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
-                text.setPosition(info.position);
+            sc->drawBase(spriteBatch);
+            sc->drawPrizes(spriteBatch);
+            spriteBatch.flush(virtualCanvas);
 
-                virtualCanvas.draw(text);
-            }
+            // Draw multiplier texts
+            sc->drawPrizeLabels(virtualCanvas, ResourceManager::getFont(mainFontId), static_cast<unsigned int>(6 * GAME_PIXEL_SCALE));
 
+            // Push this frame's scratch changes to the overlay texture in one partial upload
+            overlayBytesUploadedThisFrame += sc->flushOverlayTexture();
             sc->drawOverlay(virtualCanvas);
         }
 
-        for (const auto& p : particles) {
-            virtualCanvas.draw(p.sprite);
-        }
+        dustParticles.setScale(GAME_PIXEL_SCALE * windowScale);
+        dustParticles.draw(virtualCanvas, scheduler.getInterpolation());
 
         drawOwnedCards(virtualCanvas);
     }
 
     if (gameOver) {
         sf::Text gameOverText;
-        gameOverText.setFont(ResourceManager::getFont("mainFont"));
+        gameOverText.setFont(ResourceManager::getFont(mainFontId));
         gameOverText.setString("Game Over!\nYou failed to reach quota of " + std::to_string(quota));
         gameOverText.setCharacterSize(static_cast<unsigned int>(6 * GAME_PIXEL_SCALE));
         gameOverText.setFillColor(sf::Color::Red);
@@ -336,6 +478,10 @@ void Game::render() {
 
     virtualCanvas.display();
 
+    lastFrameBatchStats = spriteBatch.getStats();
+    LOG_TRACE(Render, "Frame batches", { { "drawCalls", lastFrameBatchStats.drawCalls },
+        { "vertices", lastFrameBatchStats.vertices }, { "overlayBytes", overlayBytesUploadedThisFrame } });
+
     finalSprite.setTexture(virtualCanvas.getTexture(), true);
     finalSprite.setScale(windowScale, windowScale);
     finalSprite.setPosition(std::round(offsetX), std::round(offsetY));
@@ -343,37 +489,58 @@ void Game::render() {
     window.clear(sf::Color::Black);
     window.draw(finalSprite);
 
-    // Draw UI texts on top of everything
-    balanceText.setString("Balance: " + std::to_string(player.getBalance()));
-    balanceText.setPosition(10.f, 10.f);
-    window.draw(balanceText);
+    if (currentState == GameState::LOADING) {
+        window.display();
+        return;
+    }
 
-    quotaText.setString("Quota: " + std::to_string(quota));
-    quotaText.setPosition(515.f, 600.f);
-    window.draw(quotaText);
+    // Draw UI texts on top of everything; the HUD only rebuilds texts whose values changed
+    hud.setBalance(player.getBalance());
+    hud.setQuota(quota);
+    hud.setRoundEarnings(roundEarnings);
 
-    roundEarningsText.setString("Round Earnings: " + std::to_string(roundEarnings));
-    roundEarningsText.setPosition(415.f, 635.f);
-    window.draw(roundEarningsText);
+    const bool showWinnings = currentState == GameState::SCRATCHING && !scratchCards.empty();
+    if (showWinnings) {
+        const ScratchCard& card = *scratchCards[currentCardIndex];
+        hud.setCardWinnings(card.getAccumulatedMoney(), card.getAccumulatedMultiplier());
+        hud.setRelics(player);
+    }
+    hud.draw(window, showWinnings);
+    profilerOverlay.draw(window, ResourceManager::getFont(mainFontId));
 
-    if (currentState == GameState::SCRATCHING && !scratchCards.empty()) {
-        std::string relicsStr;
-        for (const auto& relic : player.getRelics()) {
-            relicsStr += relic + " ";
-        }
+    {
+        PROFILE_ZONE("Game::present");
+        window.display();
+    }
+}
 
-        winningsText.setString(
-            "Winnings so far: " + std::to_string(scratchCards[currentCardIndex]->getAccumulatedMoney()) + "\n" +
-            "Multiplier: x" + std::to_string(scratchCards[currentCardIndex]->getAccumulatedMultiplier()) + "\n" +
-            "Relics: " + relicsStr
-        );
+ScratchCard& Game::prepareCard(size_t index) {
+    auto& sc = scratchCards[index];
+    if (!sc) {
+        sc = std::make_unique<ScratchCard>("assets/sprites/lucky_7.png", "assets/sprites/lucky_7_overlay.png", GAME_PIXEL_SCALE);
+        sc->loadCard(Catalog::cardName(ownedCardsToScratch[index]));
+        sc->setRules(relicPlan.getRules());
 
-        sf::FloatRect balanceBounds = balanceText.getGlobalBounds();
-        winningsText.setPosition(10.f, balanceBounds.top + balanceBounds.height + 10.f);
-        window.draw(winningsText);
+        // Prizes depend only on (run seed, round, card index), so build order does not matter
+        sc->assignRandomPrizes(Random::card(currentRound, static_cast<int>(index)));
+
+        sc->setPosition(
+            (DEFAULT_WIDTH - sc->getWidth()) / 2.f,
+            (DEFAULT_HEIGHT - sc->getHeight()) / 2.f
+        );
     }
+    return *sc;
+}
 
-    window.display();
+void Game::prepareUpcomingCards() {
+    // Spread setup over frames so large decks never stall a single frame
+    const size_t last = std::min(scratchCards.size(), currentCardIndex + 1 + CARDS_PREPARED_AHEAD);
+    for (size_t i = currentCardIndex; i < last; ++i) {
+        if (!scratchCards[i]) {
+            prepareCard(i);
+            if (i > currentCardIndex) return;
+        }
+    }
 }
 
 void Game::updateWindowScale() {
@@ -395,42 +562,72 @@ void Game::toggleFullscreen() {
         "Scratch Card Roguelike",
         isFullscreen ? sf::Style::Fullscreen : sf::Style::Default
     );
+    applyFramePacing();
     updateWindowScale();
 }
 
-void Game::drawOwnedCards(sf::RenderTarget& target) {
-    // Preview texture for owned cards in shop
-    const sf::Texture& cardPreviewTexture = ResourceManager::getTexture("lucky_7_shop");
-
-    int ownedLucky7Count = 0;
-    const auto& ownedCardsCount = player.getOwnedCardsCount();
+void Game::applyFramePacing() {
+    window.setVerticalSyncEnabled(frameSettings.pacing == FramePacing::VSync);
+    window.setFramerateLimit(frameSettings.pacing == FramePacing::Capped ? frameSettings.frameRateLimit : 0);
+}
 
-    auto it = ownedCardsCount.find("lucky_7_shop");  // Note: check key correctness!
-    if (it != ownedCardsCount.end()) {
-        ownedLucky7Count = it->second;
-    }
+void Game::drawOwnedCards(sf::RenderTarget& target) {
+    const int ownedLucky7Count = player.getCardCount(lucky7CardId);
 
     if (ownedLucky7Count > 0) {
         float x = DEFAULT_WIDTH - 250.f;
         float y = 50.f;
 
-        sf::Sprite cardSprite(cardPreviewTexture);
+        // Preview of owned cards in shop
+        sf::Sprite cardSprite;
+        ResourceManager::setSpriteTexture(cardSprite, cardPreviewTextureId);
         cardSprite.setScale(GAME_PIXEL_SCALE, GAME_PIXEL_SCALE);
         cardSprite.setPosition(x, y);
-        target.draw(cardSprite);
+        spriteBatch.draw(cardSprite, SpriteLayer::Ui);
+        spriteBatch.flush(target);
 
-        sf::Text countText;
-        countText.setFont(ResourceManager::getFont("mainFont"));
-        countText.setCharacterSize(static_cast<unsigned int>(14 * GAME_PIXEL_SCALE));
-        countText.setFillColor(sf::Color::White);
-        countText.setString("x" + std::to_string(ownedLucky7Count));
+        // The count string is only rebuilt when the count changes
+        if (ownedCardsCountShown != ownedLucky7Count) {
+            ownedCardsCountShown = ownedLucky7Count;
+            ownedCardsCountText.setString("x" + std::to_string(ownedLucky7Count));
+        }
 
         sf::FloatRect spriteBounds = cardSprite.getGlobalBounds();
-        countText.setPosition(spriteBounds.left + spriteBounds.width + 5.f, y + spriteBounds.height / 4.f);
-        target.draw(countText);
+        ownedCardsCountText.setPosition(spriteBounds.left + spriteBounds.width + 5.f, y + spriteBounds.height / 4.f);
+        target.draw(ownedCardsCountText);
     }
 }
 
+void Game::drawLoadingScreen(sf::RenderTarget& target) {
+    const LoadProgress progress = ResourceManager::getLoadProgress();
+
+    const sf::Vector2f barSize(DEFAULT_WIDTH / 2.f, 8.f * GAME_PIXEL_SCALE);
+    const sf::Vector2f barPosition((DEFAULT_WIDTH - barSize.x) / 2.f, (DEFAULT_HEIGHT - barSize.y) / 2.f);
+
+    sf::RectangleShape frame(barSize);
+    frame.setPosition(barPosition);
+    frame.setFillColor(sf::Color(50, 50, 50));
+    frame.setOutlineColor(sf::Color::White);
+    frame.setOutlineThickness(GAME_PIXEL_SCALE);
+    target.draw(frame);
+
+    sf::RectangleShape fill(sf::Vector2f(barSize.x * progress.getFraction(), barSize.y));
+    fill.setPosition(barPosition);
+    fill.setFillColor(sf::Color::Yellow);
+    target.draw(fill);
+
+    sf::Text loadingText;
+    loadingText.setFont(ResourceManager::getFont(mainFontId));
+    loadingText.setCharacterSize(static_cast<unsigned int>(8 * GAME_PIXEL_SCALE));
+    loadingText.setFillColor(sf::Color::White);
+    loadingText.setString("Loading " + std::to_string(progress.completed) + "/" + std::to_string(progress.requested));
+
+    sf::FloatRect bounds = loadingText.getLocalBounds();
+    loadingText.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height);
+    loadingText.setPosition(DEFAULT_WIDTH / 2.f, barPosition.y - 4.f * GAME_PIXEL_SCALE);
+    target.draw(loadingText);
+}
+
 void Game::checkRoundEnd() {
     if (currentCardIndex >= scratchCards.size()) {
         if (roundEarnings < quota) {
@@ -448,6 +645,6 @@ void Game::checkRoundEnd() {
 void Game::triggerGameOver() {
     gameOver = true;
     currentState = GameState::RESULT;  // Could also use GAME_OVER for clarity
-    std::cout << "Game Over! You failed to reach quota of " << quota << "!\n";
+    LOG_INFO(Game, "Game over, quota not reached", { { "quota", quota }, { "earnings", roundEarnings } });
     // Additional handling: show message, reset game, etc.
 }
@@ -8,17 +8,17 @@
 #include "Shop.h"
 #include "ShopView.h"
 #include "ResourceManager.h"
-
-// Simple particle system for scratch effects
-struct Particle {
-    sf::Sprite sprite;
-    sf::Vector2f velocity;
-    sf::Vector2f acceleration;
-    float lifetime; // in seconds
-};
+#include "ParticleSystem.h"
+#include "Hud.h"
+#include "SpriteBatch.h"
+#include "FrameScheduler.h"
+#include "ProfilerOverlay.h"
+#include "PointerInput.h"
+#include "RelicPlan.h"
 
 // Main game states
 enum class GameState {
+    LOADING,
     SHOP,
     SCRATCHING,
     RESULT,
@@ -30,27 +30,64 @@ public:
     Game();
     void run();
 
+    // Sprite batch draw calls and vertices of the last rendered frame
+    const SpriteBatch::Stats& getLastFrameBatchStats() const { return lastFrameBatchStats; }
+
 private:
     // Core game loop helpers
     void processEvents();
-    void update(float dt);
+
+    // Block on window events until one needs a new frame or something starts animating
+    void waitForRedraw();
+    void handleEvent(const sf::Event& event);
+
+    // One simulation step; pointer samples stamped up to inputTime are applied to the stroke
+    void update(float dt, std::int64_t inputTime);
     void render();
 
+    // Extend the stroke on the current card through every queued pointer sample up to until
+    // (samples are dropped when nothing is being scratched)
+    void scratchAlongPointer(std::int64_t until);
+
+    // Read the events that arrived while the frame was simulated and apply their pointer samples,
+    // right before the card is drawn. Other events are kept for the next processEvents.
+    void latchPointerInput();
+
+    // True while something on screen changes without input (loading, scratching, particles, auto scratch)
+    bool isAnimating() const;
+
+    // Apply frameSettings to the window; repeated whenever the window is recreated
+    void applyFramePacing();
+
     // Window scale and fullscreen handling
     void updateWindowScale();
     void toggleFullscreen();
 
     // Drawing helpers
     void drawOwnedCards(sf::RenderTarget& target);
+    void drawLoadingScreen(sf::RenderTarget& target);
 
     // Round and game state management
     void startNewRound();
+
+    // Build the scratch card at index if it has not been built yet
+    ScratchCard& prepareCard(size_t index);
+
+    // Build at most one upcoming card per frame, up to CARDS_PREPARED_AHEAD past the current one
+    void prepareUpcomingCards();
     void checkRoundEnd();
     void triggerGameOver();
 
-    // Resource loading helper
+    // Resource loading: the font loads immediately, textures are queued for async loading
     void loadResources();
 
+    // Upload decoded textures within the per-frame budget; finishes loading once all are in.
+    // Called once per rendered frame while loading
+    void uploadLoadedTextures();
+
+    // Build the views that need textures, once every queued texture has been uploaded
+    void finishLoading();
+
 private:
     sf::RenderWindow window;
     sf::RenderTexture virtualCanvas;  // For scaling and smoothing
@@ -64,25 +101,48 @@ private:
     float offsetY = 0.f;
 
     Player player;
+    RelicPlan relicPlan;    // Relic modifiers for odds, payouts, prices and quotas; follows player's relics
     Shop shop;
     std::unique_ptr<ShopView> shopView;
 
-    GameState currentState = GameState::SHOP;
+    GameState currentState = GameState::LOADING;
+
+    // UI texts, re-laid out only when their values change
+    Hud hud;
+    sf::Text ownedCardsCountText;    // "xN" next to the owned card preview
+    int ownedCardsCountShown = 0;    // Count ownedCardsCountText shows (0 = not built)
 
-    // UI texts
-    sf::Text balanceText;
-    sf::Text winningsText;
-    sf::Text quotaText;
-    sf::Text roundEarningsText;
+    SpriteBatch spriteBatch;                 // Cards, symbols, shop items and icons
+    SpriteBatch::Stats lastFrameBatchStats;  // Batch draw calls and vertices of the last rendered frame
 
     bool isScratching = false;
+    PointerInput pointerInput;                 // Timestamped samples from every MouseMoved event
+    std::vector<PointerSample> pointerPath;    // Samples applied by the current step (reused)
+    std::vector<sf::Event> deferredEvents;     // Read while late-latching, handled next frame
+    size_t brushPresetIndex = 0;   // Selected entry in BRUSH_PRESETS
 
-    std::vector<Particle> particles;
+    ParticleSystem dustParticles{ 8192 };   // Scratch dust pool, drawn in one batch
+
+    // Resource handles used every frame, interned once
+    FontId mainFontId;
+    TextureId dustTextureId;
+    TextureId cardPreviewTextureId;
+    CardId lucky7CardId;            // Card counted by the owned-cards preview
 
     sf::Clock deltaClock;
+    FrameSettings frameSettings;    // Frame cap / vsync and idle rendering, from the environment
+    FrameScheduler scheduler;       // Fixed simulation step; update() always gets scheduler.getStep()
+    bool redrawRequested = true;    // Input arrived since the last rendered frame
+    ProfilerOverlay profilerOverlay;  // F3 toggles, F4 writes a trace
+    sf::Clock loadingClock;         // Time since textures were queued, for the loading report
+
+    // Overlay texture bytes uploaded during the last rendered frame
+    size_t overlayBytesUploadedThisFrame = 0;
 
+    // One slot per card of the round; cards are built just before they are needed
+    // and released once scratched, so only the current card and the next few exist
     std::vector<std::unique_ptr<ScratchCard>> scratchCards;
-    std::vector<std::string> ownedCardsToScratch;
+    std::vector<CardId> ownedCardsToScratch;
     size_t currentCardIndex = 0;
 
     bool cardProcessed = false;
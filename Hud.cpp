@@ -0,0 +1,92 @@
+#include "Hud.h"
+#include "Player.h"
+
+Hud::Hud() {
+    balanceText.setFillColor(sf::Color::White);
+    winningsText.setFillColor(sf::Color::Yellow);
+    quotaText.setFillColor(sf::Color::Cyan);
+    roundEarningsText.setFillColor(sf::Color::Yellow);
+
+    balanceText.setPosition(10.f, 10.f);
+    quotaText.setPosition(515.f, 600.f);
+    roundEarningsText.setPosition(415.f, 635.f);
+}
+
+void Hud::setFont(const sf::Font& font, unsigned int characterSize) {
+    for (auto* textObj : { &balanceText, &winningsText, &quotaText, &roundEarningsText }) {
+        textObj->setFont(font);
+        textObj->setCharacterSize(characterSize);
+    }
+    layoutDirty = true;
+}
+
+void Hud::setBalance(int value) {
+    if (balanceShown && value == balance) return;
+    balance = value;
+    balanceShown = true;
+    balanceText.setString("Balance: " + std::to_string(balance));
+    layoutDirty = true;
+}
+
+void Hud::setQuota(int value) {
+    if (quotaShown && value == quota) return;
+    quota = value;
+    quotaShown = true;
+    quotaText.setString("Quota: " + std::to_string(quota));
+}
+
+void Hud::setRoundEarnings(int value) {
+    if (roundEarningsShown && value == roundEarnings) return;
+    roundEarnings = value;
+    roundEarningsShown = true;
+    roundEarningsText.setString("Round Earnings: " + std::to_string(roundEarnings));
+}
+
+void Hud::setCardWinnings(int money, float multiplier) {
+    if (winningsShown && money == cardMoney && multiplier == cardMultiplier) return;
+    cardMoney = money;
+    cardMultiplier = multiplier;
+    winningsShown = true;
+    winningsDirty = true;
+}
+
+void Hud::setRelics(const Player& player) {
+    if (relicsShown && player.getRelicsVersion() == relicsVersion) return;
+    relicsVersion = player.getRelicsVersion();
+    relicsShown = true;
+
+    relicsLine = "Relics: ";
+    for (RelicId relic : player.getRelics()) {
+        relicsLine += Catalog::relicName(relic);
+        const int stack = player.getRelicStack(relic);
+        if (stack > 1) relicsLine += " x" + std::to_string(stack);
+        relicsLine += " ";
+    }
+    winningsDirty = true;
+}
+
+// Join the winnings lines into one string; only runs after a value changed
+void Hud::rebuildWinnings() {
+    winningsText.setString(
+        "Winnings so far: " + std::to_string(cardMoney) + "\n" +
+        "Multiplier: x" + std::to_string(cardMultiplier) + "\n" +
+        relicsLine
+    );
+    winningsDirty = false;
+}
+
+void Hud::draw(sf::RenderTarget& target, bool showWinnings) {
+    target.draw(balanceText);
+    target.draw(quotaText);
+    target.draw(roundEarningsText);
+
+    if (!showWinnings) return;
+
+    if (winningsDirty) rebuildWinnings();
+    if (layoutDirty) {
+        sf::FloatRect balanceBounds = balanceText.getGlobalBounds();
+        winningsText.setPosition(10.f, balanceBounds.top + balanceBounds.height + 10.f);
+        layoutDirty = false;
+    }
+    target.draw(winningsText);
+}
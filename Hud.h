@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+
+class Player;
+
+// Balance, quota, round earnings and current-card winnings drawn over the game.
+// Each text's string and glyph geometry is rebuilt only when the value it shows changes;
+// steady-state frames just redraw the cached sf::Text vertex arrays.
+class Hud {
+public:
+    Hud();
+
+    // Font and character size shared by every HUD text
+    void setFont(const sf::Font& font, unsigned int characterSize);
+
+    // Values shown; each setter is a no-op when the value is unchanged
+    void setBalance(int balance);
+    void setQuota(int quota);
+    void setRoundEarnings(int roundEarnings);
+    void setCardWinnings(int money, float multiplier);
+
+    // Relic names with stack counts; the list is only re-joined when the player's relic version changes
+    void setRelics(const Player& player);
+
+    // Draw balance, quota and earnings, plus the winnings block when showWinnings is set
+    void draw(sf::RenderTarget& target, bool showWinnings);
+
+private:
+    sf::Text balanceText;
+    sf::Text quotaText;
+    sf::Text roundEarningsText;
+    sf::Text winningsText;
+
+    // Values the texts currently show (set on the first setter call)
+    int balance = 0;
+    int quota = 0;
+    int roundEarnings = 0;
+    int cardMoney = 0;
+    float cardMultiplier = 0.f;
+    std::uint32_t relicsVersion = 0;
+    std::string relicsLine;          // "Relics: a b x2 "
+
+    bool balanceShown = false;
+    bool quotaShown = false;
+    bool roundEarningsShown = false;
+    bool winningsShown = false;
+    bool relicsShown = false;
+    bool winningsDirty = true;       // Winnings block needs rebuilding before the next draw
+    bool layoutDirty = true;         // Winnings position depends on the balance text bounds
+
+    void rebuildWinnings();
+};
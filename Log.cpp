@@ -0,0 +1,300 @@
+#include "Log.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+    constexpr size_t RING_CAPACITY = 4096;              // Power of two
+    constexpr size_t RING_MASK = RING_CAPACITY - 1;
+    constexpr size_t TEXT_CAPACITY = 232;               // Formatted message and fields, truncated to fit
+
+    // One queued log line. sequence implements a bounded multi-producer queue (Vyukov):
+    // a slot is free for position p when sequence == p and ready to read when sequence == p + 1.
+    struct Record {
+        std::atomic<size_t> sequence{ 0 };
+        double time = 0.0;
+        Log::Level level = Log::Level::Info;
+        Log::Category category = Log::Category::General;
+        std::uint16_t length = 0;
+        char text[TEXT_CAPACITY];
+    };
+
+    enum class State { Idle, Running, Stopped };
+
+    struct Logger {
+        std::unique_ptr<Record[]> ring{ new Record[RING_CAPACITY] };
+        alignas(64) std::atomic<size_t> enqueuePos{ 0 };
+        alignas(64) size_t dequeuePos = 0;               // Drain thread only
+
+        std::atomic<std::uint64_t> dropped{ 0 };
+        std::uint64_t droppedReported = 0;               // Drain thread only
+        std::atomic<int> levels[static_cast<size_t>(Log::Category::Count)];
+
+        std::atomic<State> state{ State::Idle };
+        std::atomic<bool> stopRequested{ false };
+        std::thread drainThread;
+        std::mutex controlMutex;                         // Guards start, shutdown and output changes
+
+        std::FILE* output = stdout;
+        bool ownsOutput = false;
+
+        const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        Logger() {
+            for (size_t i = 0; i < RING_CAPACITY; ++i) ring[i].sequence.store(i, std::memory_order_relaxed);
+            for (auto& level : levels) level.store(LOG_LEVEL_TRACE, std::memory_order_relaxed);
+        }
+
+        ~Logger();
+    };
+
+    Logger& logger() {
+        static Logger instance;
+        return instance;
+    }
+
+    const char* levelName(Log::Level level) {
+        switch (level) {
+        case Log::Level::Trace: return "TRACE";
+        case Log::Level::Debug: return "DEBUG";
+        case Log::Level::Info:  return "INFO";
+        case Log::Level::Warn:  return "WARN";
+        case Log::Level::Error: return "ERROR";
+        default: return "?";
+        }
+    }
+
+    const char* categoryName(Log::Category category) {
+        switch (category) {
+        case Log::Category::General:   return "general";
+        case Log::Category::Game:      return "game";
+        case Log::Category::Cards:     return "cards";
+        case Log::Category::Prizes:    return "prizes";
+        case Log::Category::Shop:      return "shop";
+        case Log::Category::Resources: return "resources";
+        case Log::Category::Render:    return "render";
+        default: return "?";
+        }
+    }
+
+    // Append as much of text as fits; returns the new length
+    size_t append(char* buffer, size_t length, const char* text) {
+        while (*text != '\0' && length < TEXT_CAPACITY) buffer[length++] = *text++;
+        return length;
+    }
+
+    // Format the message and its fields into a record's text
+    void formatRecord(Record& record, const char* message, std::initializer_list<Log::Field> fields) {
+        size_t length = append(record.text, 0, message);
+
+        char number[32];
+        for (const Log::Field& field : fields) {
+            length = append(record.text, length, " ");
+            length = append(record.text, length, field.key);
+            length = append(record.text, length, "=");
+
+            switch (field.kind) {
+            case Log::Field::Kind::Int:
+                std::snprintf(number, sizeof(number), "%lld", field.intValue);
+                length = append(record.text, length, number);
+                break;
+            case Log::Field::Kind::Float:
+                std::snprintf(number, sizeof(number), "%g", field.floatValue);
+                length = append(record.text, length, number);
+                break;
+            case Log::Field::Kind::Text:
+                length = append(record.text, length, field.textValue ? field.textValue : "(null)");
+                break;
+            }
+        }
+
+        record.length = static_cast<std::uint16_t>(length);
+    }
+
+    // Write one record as a line of text
+    void printRecord(std::FILE* out, const Record& record) {
+        std::fprintf(out, "[%9.3f] %-5s %-9s %.*s\n", record.time, levelName(record.level),
+            categoryName(record.category), static_cast<int>(record.length), record.text);
+    }
+
+    // Move every ready record to the output; returns how many were written
+    size_t drainAvailable(Logger& log) {
+        size_t written = 0;
+        for (;;) {
+            Record& record = log.ring[log.dequeuePos & RING_MASK];
+            if (record.sequence.load(std::memory_order_acquire) != log.dequeuePos + 1) break;
+
+            printRecord(log.output, record);
+            record.sequence.store(log.dequeuePos + RING_CAPACITY, std::memory_order_release);
+            ++log.dequeuePos;
+            ++written;
+        }
+
+        const std::uint64_t dropped = log.dropped.load(std::memory_order_relaxed);
+        if (dropped != log.droppedReported) {
+            std::fprintf(log.output, "[log] ring full, dropped %llu record(s)\n",
+                static_cast<unsigned long long>(dropped - log.droppedReported));
+            log.droppedReported = dropped;
+            ++written;
+        }
+        return written;
+    }
+
+    // Background thread: drain in batches and flush only once the ring is empty
+    void drainLoop(Logger& log) {
+        bool pendingFlush = false;
+        for (;;) {
+            const bool stopping = log.stopRequested.load(std::memory_order_acquire);
+            if (drainAvailable(log) > 0) {
+                pendingFlush = true;
+                continue;
+            }
+
+            if (pendingFlush) {
+                std::fflush(log.output);
+                pendingFlush = false;
+            }
+            if (stopping) break;
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    // Stop the drain thread after it has written everything queued, then flush
+    void stopLogger(Logger& log) {
+        std::lock_guard<std::mutex> lock(log.controlMutex);
+        if (log.state.load() == State::Running) {
+            log.stopRequested.store(true, std::memory_order_release);
+            log.drainThread.join();
+        }
+        log.state.store(State::Stopped, std::memory_order_release);
+
+        // Records claimed but published after the drain thread's last pass
+        drainAvailable(log);
+        std::fflush(log.output);
+    }
+
+    Logger::~Logger() {
+        stopLogger(*this);
+        if (ownsOutput) std::fclose(output);
+    }
+}
+
+namespace Log {
+    // Start the drain thread (also started on first write)
+    void start() {
+        Logger& log = logger();
+        std::lock_guard<std::mutex> lock(log.controlMutex);
+        if (log.state.load() != State::Idle) return;
+
+        log.stopRequested.store(false);
+        log.drainThread = std::thread(drainLoop, std::ref(log));
+        log.state.store(State::Running, std::memory_order_release);
+    }
+
+    // Drain everything still queued, flush and stop the drain thread
+    void shutdown() {
+        stopLogger(logger());
+    }
+
+    // Send output to a file instead of stdout
+    bool setOutputFile(const std::string& path) {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        if (!file) return false;
+
+        Logger& log = logger();
+        std::lock_guard<std::mutex> lock(log.controlMutex);
+        const bool wasRunning = log.state.load() == State::Running;
+        if (wasRunning) {
+            log.stopRequested.store(true, std::memory_order_release);
+            log.drainThread.join();
+        }
+
+        std::fflush(log.output);
+        if (log.ownsOutput) std::fclose(log.output);
+        log.output = file;
+        log.ownsOutput = true;
+
+        if (wasRunning) {
+            log.stopRequested.store(false);
+            log.drainThread = std::thread(drainLoop, std::ref(log));
+        }
+        return true;
+    }
+
+    void setLevel(Level level) {
+        for (auto& categoryLevel : logger().levels) {
+            categoryLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+        }
+    }
+
+    void setCategoryLevel(Category category, Level level) {
+        logger().levels[static_cast<size_t>(category)].store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+    bool isEnabled(Level level, Category category) {
+        return static_cast<int>(level) >= logger().levels[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t getDroppedCount() {
+        return logger().dropped.load(std::memory_order_relaxed);
+    }
+
+    // Claim a ring slot, format into it and publish it; never blocks
+    void write(Level level, Category category, const char* message, std::initializer_list<Field> fields) {
+        Logger& log = logger();
+        const State state = log.state.load(std::memory_order_acquire);
+        if (state == State::Idle) start();
+
+        const double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - log.startTime).count();
+
+        // After shutdown there is no drain thread; write synchronously
+        if (state == State::Stopped) {
+            Record record;
+            record.time = time;
+            record.level = level;
+            record.category = category;
+            formatRecord(record, message, fields);
+
+            std::lock_guard<std::mutex> lock(log.controlMutex);
+            printRecord(log.output, record);
+            return;
+        }
+
+        size_t pos = log.enqueuePos.load(std::memory_order_relaxed);
+        Record* record = nullptr;
+        for (;;) {
+            Record& slot = log.ring[pos & RING_MASK];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0) {
+                if (log.enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    record = &slot;
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                log.dropped.fetch_add(1, std::memory_order_relaxed); // Ring full
+                return;
+            }
+            else {
+                pos = log.enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        record->time = time;
+        record->level = level;
+        record->category = category;
+        formatRecord(*record, message, fields);
+        record->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    void write(Level level, Category category, const std::string& message, std::initializer_list<Field> fields) {
+        write(level, category, message.c_str(), fields);
+    }
+}
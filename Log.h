@@ -0,0 +1,129 @@
+#pragma once
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+// Severity levels, lowest first
+#define LOG_LEVEL_TRACE 0
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_WARN  3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_OFF   5
+
+// Calls below this level compile to nothing. Override with -DLOG_COMPILE_LEVEL=LOG_LEVEL_...
+#ifndef LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define LOG_COMPILE_LEVEL LOG_LEVEL_INFO
+#else
+#define LOG_COMPILE_LEVEL LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// Asynchronous leveled logger.
+// Callers format a record into a slot of a lock-free ring buffer and return immediately;
+// a background thread drains the ring and writes to stdout (or a file), flushing only when
+// the ring runs dry. When the ring is full, records are dropped and counted rather than
+// blocking the game thread.
+namespace Log {
+    enum class Level : std::uint8_t {
+        Trace = LOG_LEVEL_TRACE,
+        Debug = LOG_LEVEL_DEBUG,
+        Info = LOG_LEVEL_INFO,
+        Warn = LOG_LEVEL_WARN,
+        Error = LOG_LEVEL_ERROR
+    };
+
+    // Subsystems, each with its own runtime level
+    enum class Category : std::uint8_t {
+        General,
+        Game,
+        Cards,
+        Prizes,
+        Shop,
+        Resources,
+        Render,
+        Count
+    };
+
+    // Structured key=value field appended to a record
+    struct Field {
+        enum class Kind : std::uint8_t { Int, Float, Text };
+
+        const char* key;
+        Kind kind;
+        long long intValue = 0;
+        double floatValue = 0.0;
+        const char* textValue = nullptr;   // Only valid during the log call
+
+        Field(const char* key, int value) : key(key), kind(Kind::Int), intValue(value) {}
+        Field(const char* key, long value) : key(key), kind(Kind::Int), intValue(value) {}
+        Field(const char* key, long long value) : key(key), kind(Kind::Int), intValue(value) {}
+        Field(const char* key, unsigned int value) : key(key), kind(Kind::Int), intValue(value) {}
+        Field(const char* key, unsigned long value) : key(key), kind(Kind::Int), intValue(static_cast<long long>(value)) {}
+        Field(const char* key, unsigned long long value) : key(key), kind(Kind::Int), intValue(static_cast<long long>(value)) {}
+        Field(const char* key, bool value) : key(key), kind(Kind::Int), intValue(value ? 1 : 0) {}
+        Field(const char* key, float value) : key(key), kind(Kind::Float), floatValue(value) {}
+        Field(const char* key, double value) : key(key), kind(Kind::Float), floatValue(value) {}
+        Field(const char* key, const char* value) : key(key), kind(Kind::Text), textValue(value) {}
+        Field(const char* key, const std::string& value) : key(key), kind(Kind::Text), textValue(value.c_str()) {}
+    };
+
+    // Start the drain thread (also started on first write)
+    void start();
+
+    // Drain everything still queued, flush and stop the drain thread
+    void shutdown();
+
+    // Send output to a file instead of stdout; returns false if it cannot be opened
+    bool setOutputFile(const std::string& path);
+
+    // Runtime filtering on top of the compile-time level
+    void setLevel(Level level);
+    void setCategoryLevel(Category category, Level level);
+    bool isEnabled(Level level, Category category);
+
+    // Records dropped because the ring was full
+    std::uint64_t getDroppedCount();
+
+    // Queue a record; use the LOG_* macros so filtered calls cost nothing
+    void write(Level level, Category category, const char* message, std::initializer_list<Field> fields = {});
+    void write(Level level, Category category, const std::string& message, std::initializer_list<Field> fields = {});
+}
+
+#define LOG_AT(level, category, ...) \
+    do { \
+        if (Log::isEnabled(Log::Level::level, Log::Category::category)) \
+            Log::write(Log::Level::level, Log::Category::category, __VA_ARGS__); \
+    } while (0)
+
+// Usage: LOG_INFO(Cards, "Zone revealed", { { "zone", index }, { "prize", "Money" } });
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_TRACE
+#define LOG_TRACE(category, ...) LOG_AT(Trace, category, __VA_ARGS__)
+#else
+#define LOG_TRACE(category, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(category, ...) LOG_AT(Debug, category, __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(category, ...) LOG_AT(Info, category, __VA_ARGS__)
+#else
+#define LOG_INFO(category, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(category, ...) LOG_AT(Warn, category, __VA_ARGS__)
+#else
+#define LOG_WARN(category, ...) ((void)0)
+#endif
+
+#if LOG_COMPILE_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(category, ...) LOG_AT(Error, category, __VA_ARGS__)
+#else
+#define LOG_ERROR(category, ...) ((void)0)
+#endif
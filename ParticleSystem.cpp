@@ -0,0 +1,116 @@
+#include "ParticleSystem.h"
+
+#include <algorithm>
+
+ParticleSystem::ParticleSystem(size_t capacity)
+    : capacity(capacity),
+    positionX(capacity),
+    positionY(capacity),
+    previousX(capacity),
+    previousY(capacity),
+    velocityX(capacity),
+    velocityY(capacity),
+    life(capacity),
+    inverseLifetime(capacity),
+    vertices(sf::Triangles)
+{
+}
+
+void ParticleSystem::setTexture(const sf::Texture& particleTexture, const sf::IntRect& rect) {
+    texture = &particleTexture;
+    textureRect = rect;
+}
+
+// Spawn up to count particles; velocities match the original single-sprite dust
+size_t ParticleSystem::emit(float x, float y, size_t requested, float lifetime, RandomStream& rng) {
+    const size_t spawned = std::min(requested, capacity - count);
+    const float inverse = 1.f / lifetime;
+
+    for (size_t i = count; i < count + spawned; ++i) {
+        positionX[i] = x;
+        positionY[i] = y;
+        previousX[i] = x;
+        previousY[i] = y;
+        velocityX[i] = (rng.unit() - 0.5f) * 20.f;
+        velocityY[i] = rng.uniform(0.f, 0.5f) * -10.f;
+        life[i] = lifetime;
+        inverseLifetime[i] = inverse;
+    }
+
+    count += spawned;
+    return spawned;
+}
+
+void ParticleSystem::update(float dt) {
+    float* px = positionX.data();
+    float* py = positionY.data();
+    float* qx = previousX.data();
+    float* qy = previousY.data();
+    float* vx = velocityX.data();
+    float* vy = velocityY.data();
+    float* remaining = life.data();
+    const float ax = accelerationX * dt;
+    const float ay = accelerationY * dt;
+
+    // Integrate every particle; independent iterations over flat arrays vectorize cleanly
+    for (size_t i = 0; i < count; ++i) {
+        qx[i] = px[i];
+        qy[i] = py[i];
+        remaining[i] -= dt;
+        vx[i] += ax;
+        vy[i] += ay;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+    }
+
+    // Swap-and-pop the expired ones; order does not matter for additive-free dust
+    size_t i = 0;
+    while (i < count) {
+        if (remaining[i] > 0.f) {
+            ++i;
+            continue;
+        }
+
+        const size_t last = --count;
+        px[i] = px[last];
+        py[i] = py[last];
+        qx[i] = qx[last];
+        qy[i] = qy[last];
+        vx[i] = vx[last];
+        vy[i] = vy[last];
+        remaining[i] = remaining[last];
+        inverseLifetime[i] = inverseLifetime[last];
+    }
+}
+
+void ParticleSystem::draw(sf::RenderTarget& target, float interpolation) {
+    if (count == 0 || !texture) return;
+
+    const float width = textureRect.width * scale;
+    const float height = textureRect.height * scale;
+    const float u0 = static_cast<float>(textureRect.left);
+    const float v0 = static_cast<float>(textureRect.top);
+    const float u1 = u0 + textureRect.width;
+    const float v1 = v0 + textureRect.height;
+
+    vertices.resize(count * 6);
+    for (size_t i = 0; i < count; ++i) {
+        const float x0 = previousX[i] + (positionX[i] - previousX[i]) * interpolation;
+        const float y0 = previousY[i] + (positionY[i] - previousY[i]) * interpolation;
+        const float x1 = x0 + width;
+        const float y1 = y0 + height;
+
+        // Fade out with remaining life
+        const sf::Color color(255, 255, 255, static_cast<sf::Uint8>(255.f * std::min(1.f, life[i] * inverseLifetime[i])));
+
+        sf::Vertex* quad = &vertices[i * 6];
+        quad[0] = sf::Vertex(sf::Vector2f(x0, y0), color, sf::Vector2f(u0, v0));
+        quad[1] = sf::Vertex(sf::Vector2f(x1, y0), color, sf::Vector2f(u1, v0));
+        quad[2] = sf::Vertex(sf::Vector2f(x1, y1), color, sf::Vector2f(u1, v1));
+        quad[3] = quad[0];
+        quad[4] = quad[2];
+        quad[5] = sf::Vertex(sf::Vector2f(x0, y1), color, sf::Vector2f(u0, v1));
+    }
+
+    target.draw(vertices, sf::RenderStates(texture));
+}
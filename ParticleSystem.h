@@ -0,0 +1,62 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "Random.h"
+
+// Fixed-capacity pool of short-lived textured particles sharing one texture region.
+// State is kept as structure-of-arrays so the update loop is plain float arithmetic the
+// compiler can vectorize; dead particles are removed by swap-and-pop, and the whole pool
+// is drawn with a single vertex array call.
+class ParticleSystem {
+public:
+    // capacity: most particles alive at once; emits beyond it are dropped
+    explicit ParticleSystem(size_t capacity);
+
+    // Texture region every particle is drawn with
+    void setTexture(const sf::Texture& texture, const sf::IntRect& rect);
+
+    // Size of each particle relative to its texture rect
+    void setScale(float particleScale) { scale = particleScale; }
+
+    // Constant acceleration applied to every particle (pixels per second squared)
+    void setAcceleration(float x, float y) { accelerationX = x; accelerationY = y; }
+
+    // Spawn count dust particles at (x, y): random sideways drift, a small upward kick,
+    // fading out over lifetime seconds. Returns how many fit in the pool.
+    size_t emit(float x, float y, size_t count, float lifetime, RandomStream& rng);
+
+    // Advance every particle by dt and remove the expired ones
+    void update(float dt);
+
+    // Draw all live particles in one call, interpolation of the way from the previous update's
+    // positions to the latest ones (1 draws the latest positions)
+    void draw(sf::RenderTarget& target, float interpolation = 1.f);
+
+    void clear() { count = 0; }
+
+    size_t size() const { return count; }
+    size_t getCapacity() const { return capacity; }
+
+private:
+    size_t capacity;
+    size_t count = 0;
+
+    // Per-particle state, one array per field, each sized to capacity
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> previousX;      // Positions before the last update, for interpolated drawing
+    std::vector<float> previousY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> life;           // Seconds remaining
+    std::vector<float> inverseLifetime;  // 1 / starting life, for the fade
+
+    float accelerationX = 0.f;
+    float accelerationY = 0.f;
+
+    const sf::Texture* texture = nullptr;
+    sf::IntRect textureRect;
+    float scale = 1.f;
+
+    sf::VertexArray vertices;          // Reused every draw, two triangles per particle
+};
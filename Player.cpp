@@ -17,12 +17,29 @@ void Player::resetBalance() {
     balance = 0;
 }
 
-void Player::addRelic(const std::string& relicName) {
-    relics.push_back(relicName);
+void Player::addRelic(RelicId relic) {
+    if (!relic.isValid()) return;
+
+    // Tables grow to the catalog size on demand; IDs are dense, so this stays small
+    if (relic.index >= relicStacks.size()) {
+        relicStacks.resize(relic.index + 1, 0);
+        relicBits.resize(relic.index / 64 + 1, 0);
+    }
+
+    if (relicStacks[relic.index]++ == 0) {
+        relicBits[relic.index / 64] |= std::uint64_t(1) << (relic.index % 64);
+        ownedRelics.push_back(relic);
+    }
+    ++relicTotal;
+    ++relicsVersion;
+}
+
+bool Player::hasRelic(RelicId relic) const {
+    return relic.index / 64 < relicBits.size() && (relicBits[relic.index / 64] >> (relic.index % 64)) & 1;
 }
 
-const std::vector<std::string>& Player::getRelics() const {
-    return relics;
+int Player::getRelicStack(RelicId relic) const {
+    return relic.index < relicStacks.size() ? relicStacks[relic.index] : 0;
 }
 
 void Player::addMultiplier(float multiplierAmount) {
@@ -33,22 +50,38 @@ float Player::getMultiplier() const {
     return multiplier;
 }
 
-void Player::addCard(const std::string& cardId) {
-    ownedCardsCount[cardId]++;
+void Player::addCard(CardId card) {
+    if (!card.isValid()) return;
+
+    if (card.index >= cardCounts.size()) {
+        cardCounts.resize(card.index + 1, 0);
+        ownedSlots.resize(card.index + 1, 0);
+    }
+
+    if (cardCounts[card.index]++ == 0) {
+        ownedSlots[card.index] = static_cast<std::uint32_t>(ownedCards.size());
+        ownedCards.push_back(card);
+    }
+    ++cardTotal;
 }
 
-bool Player::useCard(const std::string& cardId) {
-    auto it = ownedCardsCount.find(cardId);
-    if (it != ownedCardsCount.end() && it->second > 0) {
-        --(it->second);
-        if (it->second == 0) {
-            ownedCardsCount.erase(it);
-        }
-        return true;
+bool Player::useCard(CardId card) {
+    if (card.index >= cardCounts.size() || cardCounts[card.index] == 0) {
+        return false; // Player does not own the card
+    }
+
+    --cardTotal;
+    if (--cardCounts[card.index] == 0) {
+        // Swap the last owned card into this one's slot
+        const std::uint32_t slot = ownedSlots[card.index];
+        const CardId moved = ownedCards.back();
+        ownedCards[slot] = moved;
+        ownedSlots[moved.index] = slot;
+        ownedCards.pop_back();
     }
-    return false; // Player does not own the card
+    return true;
 }
 
-const std::unordered_map<std::string, int>& Player::getOwnedCardsCount() const {
-    return ownedCardsCount;
+int Player::getCardCount(CardId card) const {
+    return card.index < cardCounts.size() ? cardCounts[card.index] : 0;
 }
@@ -1,9 +1,12 @@
 #pragma once
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <cstdint>
+#include "Catalog.h"
 
-// Represents the player state and inventory
+// Represents the player state and inventory.
+// Cards and relics are stored by catalog index: counts live in flat arrays and relic ownership in
+// a bitset, so add/use/has are O(1), and the owned lists iterate without allocating.
 class Player {
 public:
     Player();
@@ -17,11 +20,23 @@ public:
     // Reset balance to zero
     void resetBalance();
 
-    // Add a relic by name to the player's inventory
-    void addRelic(const std::string& relicName);
+    // Add one copy of a relic; copies of the same relic stack
+    void addRelic(RelicId relic);
+    void addRelic(const std::string& relicName) { addRelic(Catalog::relicId(relicName)); }
 
-    // Get all relics owned
-    const std::vector<std::string>& getRelics() const;
+    bool hasRelic(RelicId relic) const;
+
+    // Copies of a relic owned (0 if none)
+    int getRelicStack(RelicId relic) const;
+
+    // Distinct relics owned, in the order they were first acquired
+    const std::vector<RelicId>& getRelics() const { return ownedRelics; }
+
+    // Relic copies owned, counting every stack
+    int getRelicTotal() const { return relicTotal; }
+
+    // Bumped whenever the relic set changes, so views and derived tables can skip rebuilding
+    std::uint32_t getRelicsVersion() const { return relicsVersion; }
 
     // Increase multiplier by given amount
     void addMultiplier(float multiplierAmount);
@@ -30,20 +45,35 @@ public:
     float getMultiplier() const;
 
     // Add a card by ID, incrementing count
-    void addCard(const std::string& cardId);
+    void addCard(CardId card);
+    void addCard(const std::string& cardName) { addCard(Catalog::cardId(cardName)); }
 
     // Use one instance of card by ID; returns true if successful
-    bool useCard(const std::string& cardId);
+    bool useCard(CardId card);
+
+    // Copies of a card owned (0 if none)
+    int getCardCount(CardId card) const;
+
+    // Distinct cards with a nonzero count, in no particular order
+    const std::vector<CardId>& getOwnedCards() const { return ownedCards; }
 
-    // Get map of owned card IDs and their counts
-    const std::unordered_map<std::string, int>& getOwnedCardsCount() const;
+    // Cards owned, counting every copy
+    int getCardTotal() const { return cardTotal; }
 
 private:
     int balance = 0;  // Player's currency balance
     float multiplier = 1.0f;  // Multiplier applied to rewards, etc.
 
-    std::vector<std::string> relics;  // Owned relics
+    // Relics, indexed by RelicId
+    std::vector<std::uint64_t> relicBits;   // Ownership bitset
+    std::vector<int> relicStacks;           // Copies per relic
+    std::vector<RelicId> ownedRelics;       // Distinct relics owned
+    int relicTotal = 0;
+    std::uint32_t relicsVersion = 0;        // Incremented on every relic change
 
-    // Map card ID -> count owned
-    std::unordered_map<std::string, int> ownedCardsCount;
+    // Cards, indexed by CardId
+    std::vector<int> cardCounts;            // Copies per card
+    std::vector<std::uint32_t> ownedSlots;  // Position of each owned card in ownedCards
+    std::vector<CardId> ownedCards;         // Cards with a nonzero count
+    int cardTotal = 0;
 };
@@ -0,0 +1,24 @@
+#include "PointerInput.h"
+
+PointerInput::PointerInput(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    samples.resize(size);
+    mask = size - 1;
+}
+
+void PointerInput::push(float x, float y) {
+    if (tail - head == samples.size()) {
+        ++head;
+        ++overwritten;
+    }
+    samples[tail & mask] = { x, y, now() };
+    ++tail;
+}
+
+void PointerInput::drainUntil(std::int64_t time, std::vector<PointerSample>& out) {
+    while (head != tail && samples[head & mask].time <= time) {
+        out.push_back(samples[head & mask]);
+        ++head;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <SFML/System/Clock.hpp>
+#include <cstdint>
+#include <vector>
+
+// One pointer position, in virtual canvas coordinates
+struct PointerSample {
+    float x = 0.f;
+    float y = 0.f;
+    std::int64_t time = 0;    // Microseconds on PointerInput's clock, taken when the event was read
+};
+
+// Queue of timestamped pointer samples fed from every MouseMoved event, so strokes follow the full
+// path the OS reported instead of one cursor poll per frame. Samples are consumed in time order:
+// each simulation step takes those up to its own end time, and rendering late-latches the rest.
+// The ring overwrites its oldest samples when full (e.g. while the game sleeps between frames).
+class PointerInput {
+public:
+    // capacity is rounded up to a power of two
+    explicit PointerInput(size_t capacity = 4096);
+
+    // Current time on the sample clock
+    std::int64_t now() const { return clock.getElapsedTime().asMicroseconds(); }
+
+    // Queue a sample stamped with the current time
+    void push(float x, float y);
+
+    // Append every sample up to and including time to out, in order, and remove them from the queue
+    void drainUntil(std::int64_t time, std::vector<PointerSample>& out);
+
+    // Drop every queued sample (e.g. when a new stroke starts)
+    void clear() { head = tail; }
+
+    size_t size() const { return static_cast<size_t>(tail - head); }
+
+    // Newest queued sample; only valid when size() > 0
+    const PointerSample& latest() const { return samples[(tail - 1) & mask]; }
+
+    // Samples overwritten before they were consumed, since construction
+    std::uint64_t getOverwrittenCount() const { return overwritten; }
+
+private:
+    sf::Clock clock;
+    std::vector<PointerSample> samples;
+    std::uint64_t mask = 0;
+    std::uint64_t head = 0;    // Oldest queued sample
+    std::uint64_t tail = 0;    // One past the newest
+    std::uint64_t overwritten = 0;
+};
@@ -0,0 +1,15 @@
+#include "PrizeRules.h"
+
+#include <algorithm>
+
+// Largest base reward in the table
+int PrizeRules::maxBaseReward() const {
+    if (lucky7Rewards.empty()) return 0;
+    return *std::max_element(lucky7Rewards.begin(), lucky7Rewards.end());
+}
+
+// The odds and rewards the game ships with
+const PrizeRules& PrizeRules::standard() {
+    static const PrizeRules rules;
+    return rules;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include "Prize.h"
+
+// Prize odds and payout table for scratch cards.
+// Shared by ScratchCardModel and the payout simulator so odds are tuned in one place.
+struct PrizeRules {
+    int moneyChance = 50;           // Percent of zones holding a lucky 7
+    int noneChance = 40;            // Percent of empty zones; the rest hold a multiplier
+    float multiplierMin = 1.5f;     // Multiplier prizes are multiplierMin + [0, multiplierSpan)
+    float multiplierSpan = 1.f;
+
+    // Base reward by number of lucky 7s revealed; counts past the end pay nothing
+    std::vector<int> lucky7Rewards = { 0, 0, 10, 20, 50, 100 };
+
+    // Prize type for a roll in [0, 100)
+    PrizeType rollType(int roll) const {
+        if (roll < moneyChance) return PrizeType::Money;
+        if (roll < moneyChance + noneChance) return PrizeType::None;
+        return PrizeType::Multiplier;
+    }
+
+    // Multiplier amount for a unit value in [0, 1)
+    float multiplierFor(float unit) const { return multiplierMin + unit * multiplierSpan; }
+
+    // Base reward for the number of lucky 7s revealed
+    int baseReward(int lucky7Count) const {
+        if (lucky7Count < 0 || lucky7Count >= static_cast<int>(lucky7Rewards.size())) return 0;
+        return lucky7Rewards[lucky7Count];
+    }
+
+    // Final payout: base reward scaled by the accumulated multiplier (which starts at 1)
+    int payout(int lucky7Count, float accumulatedMultiplier) const {
+        return static_cast<int>(baseReward(lucky7Count) * accumulatedMultiplier);
+    }
+
+    // Largest base reward in the table
+    int maxBaseReward() const;
+
+    // The odds and rewards the game ships with
+    static const PrizeRules& standard();
+};
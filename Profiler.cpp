@@ -0,0 +1,299 @@
+#include "Profiler.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace {
+    constexpr size_t RING_CAPACITY = 8192;   // Finished zones per thread between two endFrame calls
+    constexpr size_t MAX_DEPTH = 64;
+
+    std::int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Taken during static initialisation, before main
+    const std::int64_t processStart = now();
+
+    // Completed zone as recorded by its thread
+    struct ZoneEvent {
+        const char* name;
+        std::int64_t start;
+        std::int64_t end;
+        std::uint32_t depth;
+    };
+
+    // Single-producer ring owned by one thread; the main thread consumes it at endFrame
+    struct ThreadRing {
+        std::array<ZoneEvent, RING_CAPACITY> events;
+        std::atomic<std::uint64_t> written{ 0 };
+        std::uint64_t read = 0;                       // Main thread only
+        std::uint32_t threadId = 0;
+
+        // Producer-side stack of open zones
+        std::array<const char*, MAX_DEPTH> openNames;
+        std::array<std::int64_t, MAX_DEPTH> openStarts;
+        std::uint32_t depth = 0;
+    };
+
+    // Trace event copied out of a ring while a capture is running
+    struct TraceEvent {
+        ZoneEvent zone;
+        std::uint32_t threadId;
+    };
+
+    struct ProfilerState {
+        std::mutex ringsMutex;                        // Guards rings (registration vs. draining)
+        std::vector<std::unique_ptr<ThreadRing>> rings;
+
+        // Main thread only
+        std::uint64_t frameIndex = 0;
+        std::int64_t frameStart = 0;
+        bool firstFrameReported = false;
+        std::vector<Profiler::ZoneStats> lastFrameZones;
+        std::vector<Profiler::ZoneStats> buildingZones;
+        std::vector<std::int64_t> zoneFirstStarts;    // Parallel to buildingZones, for ordering
+        std::vector<size_t> zoneOrder;                // Reused sort buffer
+        std::array<float, Profiler::FRAME_HISTORY> frameHistory{};
+        size_t frameHistoryCount = 0;
+        size_t frameHistoryNext = 0;
+        std::uint64_t droppedEvents = 0;
+
+        // Pending trace capture
+        bool traceRequested = false;
+        std::uint64_t traceFirst = 0;
+        std::uint64_t traceEnd = 0;
+        std::string tracePath;
+        std::vector<TraceEvent> traceEvents;
+    };
+
+    ProfilerState& state() {
+        static ProfilerState instance;
+        return instance;
+    }
+
+    ThreadRing& threadRing() {
+        thread_local ThreadRing* ring = nullptr;
+        if (!ring) {
+            ProfilerState& s = state();
+            std::lock_guard<std::mutex> lock(s.ringsMutex);
+            s.rings.push_back(std::make_unique<ThreadRing>());
+            ring = s.rings.back().get();
+            ring->threadId = static_cast<std::uint32_t>(s.rings.size());
+        }
+        return *ring;
+    }
+
+    // Add one event to the frame's per-zone totals
+    void accumulate(ProfilerState& s, const ZoneEvent& event) {
+        const double ms = (event.end - event.start) / 1e6;
+        for (size_t i = 0; i < s.buildingZones.size(); ++i) {
+            if (s.buildingZones[i].name == event.name) {
+                s.buildingZones[i].calls++;
+                s.buildingZones[i].milliseconds += ms;
+                if (event.start < s.zoneFirstStarts[i]) {
+                    s.zoneFirstStarts[i] = event.start;
+                    s.buildingZones[i].depth = event.depth;
+                }
+                return;
+            }
+        }
+        s.buildingZones.push_back({ event.name, event.depth, 1, ms });
+        s.zoneFirstStarts.push_back(event.start);
+    }
+
+    // Pull every finished zone out of every thread's ring
+    void drainRings(ProfilerState& s, bool capturing) {
+        std::lock_guard<std::mutex> lock(s.ringsMutex);
+        for (auto& ring : s.rings) {
+            const std::uint64_t written = ring->written.load(std::memory_order_acquire);
+            if (written - ring->read > RING_CAPACITY) {
+                s.droppedEvents += written - ring->read - RING_CAPACITY;
+                ring->read = written - RING_CAPACITY;
+            }
+
+            for (; ring->read < written; ++ring->read) {
+                const ZoneEvent event = ring->events[ring->read % RING_CAPACITY];
+
+                // The producer may have lapped this slot while it was copied; drop it if so
+                if (ring->written.load(std::memory_order_acquire) - ring->read >= RING_CAPACITY) {
+                    ++s.droppedEvents;
+                    continue;
+                }
+
+                accumulate(s, event);
+                if (capturing) s.traceEvents.push_back({ event, ring->threadId });
+            }
+        }
+    }
+
+    void appendJsonString(std::string& out, const char* text) {
+        out += '"';
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') out += '\\';
+            out += *c;
+        }
+        out += '"';
+    }
+
+    void writeTrace(ProfilerState& s) {
+        std::string json = "{\"traceEvents\":[\n";
+        char buffer[160];
+        for (size_t i = 0; i < s.traceEvents.size(); ++i) {
+            const TraceEvent& event = s.traceEvents[i];
+            json += "{\"name\":";
+            appendJsonString(json, event.zone.name);
+            std::snprintf(buffer, sizeof(buffer), ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}%s\n",
+                event.threadId, (event.zone.start - processStart) / 1e3, (event.zone.end - event.zone.start) / 1e3,
+                i + 1 < s.traceEvents.size() ? "," : "");
+            json += buffer;
+        }
+        json += "],\"displayTimeUnit\":\"ms\"}\n";
+
+        std::ofstream file(s.tracePath, std::ios::binary);
+        if (!file || !file.write(json.data(), static_cast<std::streamsize>(json.size()))) {
+            LOG_ERROR(Render, "Failed to write profiler trace", { { "path", s.tracePath } });
+        }
+        else {
+            LOG_INFO(Render, "Wrote profiler trace", { { "path", s.tracePath }, { "events", s.traceEvents.size() },
+                { "firstFrame", s.traceFirst }, { "frames", s.traceEnd - s.traceFirst } });
+        }
+
+        s.traceEvents.clear();
+        s.traceEvents.shrink_to_fit();
+    }
+}
+
+namespace Profiler {
+    void beginZone(const char* name) {
+        ThreadRing& ring = threadRing();
+        if (ring.depth < MAX_DEPTH) {
+            ring.openNames[ring.depth] = name;
+            ring.openStarts[ring.depth] = now();
+        }
+        ++ring.depth;
+    }
+
+    void endZone() {
+        ThreadRing& ring = threadRing();
+        --ring.depth;
+        if (ring.depth >= MAX_DEPTH) return;
+
+        const std::uint64_t index = ring.written.load(std::memory_order_relaxed);
+        ring.events[index % RING_CAPACITY] = { ring.openNames[ring.depth], ring.openStarts[ring.depth], now(), ring.depth };
+        ring.written.store(index + 1, std::memory_order_release);
+    }
+
+    void beginFrame() {
+        state().frameStart = now();
+    }
+
+    void endFrame() {
+        ProfilerState& s = state();
+        const std::int64_t frameEnd = now();
+
+        if (!s.firstFrameReported) {
+            s.firstFrameReported = true;
+            LOG_INFO(Render, "Time to first frame", { { "ms", (frameEnd - processStart) / 1e6 } });
+        }
+
+        const bool capturing = s.traceRequested && s.frameIndex >= s.traceFirst && s.frameIndex < s.traceEnd;
+        s.buildingZones.clear();
+        s.zoneFirstStarts.clear();
+        drainRings(s, capturing);
+
+        // Parents start no later than their children, so start order nests correctly
+        std::vector<size_t>& order = s.zoneOrder;
+        order.resize(s.buildingZones.size());
+        for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&s](size_t a, size_t b) {
+            if (s.zoneFirstStarts[a] != s.zoneFirstStarts[b]) return s.zoneFirstStarts[a] < s.zoneFirstStarts[b];
+            return s.buildingZones[a].depth < s.buildingZones[b].depth;
+        });
+        s.lastFrameZones.clear();
+        for (size_t index : order) s.lastFrameZones.push_back(s.buildingZones[index]);
+
+        s.frameHistory[s.frameHistoryNext] = static_cast<float>((frameEnd - s.frameStart) / 1e6);
+        s.frameHistoryNext = (s.frameHistoryNext + 1) % FRAME_HISTORY;
+        s.frameHistoryCount = std::min(s.frameHistoryCount + 1, FRAME_HISTORY);
+
+        if (s.droppedEvents > 0) {
+            LOG_WARN(Render, "Profiler ring overflowed, zones dropped", { { "count", s.droppedEvents } });
+            s.droppedEvents = 0;
+        }
+
+        if (s.traceRequested && s.frameIndex + 1 >= s.traceEnd) {
+            s.traceRequested = false;
+            writeTrace(s);
+        }
+
+        ++s.frameIndex;
+    }
+
+    std::uint64_t getFrameIndex() {
+        return state().frameIndex;
+    }
+
+    const std::vector<ZoneStats>& getLastFrameZones() {
+        return state().lastFrameZones;
+    }
+
+    std::vector<float> getFrameHistory() {
+        const ProfilerState& s = state();
+        std::vector<float> history;
+        history.reserve(s.frameHistoryCount);
+        const size_t oldest = (s.frameHistoryNext + FRAME_HISTORY - s.frameHistoryCount) % FRAME_HISTORY;
+        for (size_t i = 0; i < s.frameHistoryCount; ++i) {
+            history.push_back(s.frameHistory[(oldest + i) % FRAME_HISTORY]);
+        }
+        return history;
+    }
+
+    double millisecondsSinceStart() {
+        return (now() - processStart) / 1e6;
+    }
+
+    void requestTrace(std::uint64_t firstFrame, std::uint64_t frameCount, const std::string& path) {
+        ProfilerState& s = state();
+        if (frameCount == 0) return;
+
+        s.traceRequested = true;
+        s.traceFirst = std::max(firstFrame, s.frameIndex);
+        s.traceEnd = s.traceFirst + frameCount;
+        s.tracePath = path;
+        s.traceEvents.clear();
+
+        if (!PROFILER_ENABLED) {
+            LOG_WARN(Render, "Profiler zones are compiled out; the trace will be empty");
+        }
+    }
+
+    void configureFromEnvironment() {
+        const char* env = std::getenv("SCRATCH_TRACE");
+        if (!env) return;
+
+        char* cursor = nullptr;
+        const std::uint64_t first = std::strtoull(env, &cursor, 10);
+        std::uint64_t count = 0;
+        std::string path = "trace.json";
+        if (*cursor == ',') {
+            count = std::strtoull(cursor + 1, &cursor, 10);
+            if (*cursor == ',') path = cursor + 1;
+        }
+
+        if (count == 0) {
+            LOG_WARN(Render, "SCRATCH_TRACE should be \"first,count[,path]\"", { { "value", env } });
+            return;
+        }
+        requestTrace(first, count, path);
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Zones compile to nothing unless enabled. Defaults to on in debug builds; override with -DPROFILER_ENABLED=0/1
+#ifndef PROFILER_ENABLED
+#ifdef NDEBUG
+#define PROFILER_ENABLED 0
+#else
+#define PROFILER_ENABLED 1
+#endif
+#endif
+
+// Scoped-zone frame profiler.
+// PROFILE_ZONE("Name") times the enclosing scope. Each thread records finished zones into its
+// own ring buffer with no locking; the main thread drains every ring at endFrame() to build
+// per-zone totals for the overlay and, while a trace is being captured, Chrome trace events.
+// Zone names must be string literals (they are stored by pointer).
+// Frame times, the frame counter and time-to-first-frame are tracked even when zones are compiled out.
+namespace Profiler {
+    // One zone's time within a frame, summed over calls and threads
+    struct ZoneStats {
+        const char* name;
+        std::uint32_t depth;      // Nesting depth of its first call (0 = top level)
+        std::uint32_t calls;
+        double milliseconds;
+    };
+
+    // Frame boundaries; call from the main thread around each loop iteration that renders
+    void beginFrame();
+    void endFrame();
+
+    // Index of the frame currently being recorded (0 for the first)
+    std::uint64_t getFrameIndex();
+
+    // Zones of the last completed frame, parents before children
+    const std::vector<ZoneStats>& getLastFrameZones();
+
+    // Durations in milliseconds of up to the last FRAME_HISTORY frames, oldest first
+    constexpr size_t FRAME_HISTORY = 240;
+    std::vector<float> getFrameHistory();
+
+    // Milliseconds since the process started
+    double millisecondsSinceStart();
+
+    // Write Chrome trace-event JSON (chrome://tracing, Perfetto) for frames
+    // [firstFrame, firstFrame + frameCount) to path once the last of them has ended
+    void requestTrace(std::uint64_t firstFrame, std::uint64_t frameCount, const std::string& path);
+
+    // Apply SCRATCH_TRACE="first,count[,path]" if set (path defaults to trace.json)
+    void configureFromEnvironment();
+
+    // Zone recording; use PROFILE_ZONE rather than calling these directly
+    void beginZone(const char* name);
+    void endZone();
+
+    class Zone {
+    public:
+        explicit Zone(const char* name) { beginZone(name); }
+        ~Zone() { endZone(); }
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+    };
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_ZONE(name) ::Profiler::Zone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name) do {} while (0)
+#endif
@@ -0,0 +1,95 @@
+#include "ProfilerOverlay.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+    constexpr float PANEL_WIDTH = 360.f;
+    constexpr float PANEL_MARGIN = 10.f;
+    constexpr float GRAPH_HEIGHT = 80.f;
+    constexpr float GRAPH_MAX_MS = 33.3f;           // Top of the graph
+    constexpr float FRAME_BUDGET_MS = 1000.f / 60.f;
+    constexpr float TEXT_REFRESH_SECONDS = 0.25f;
+    constexpr unsigned int CHARACTER_SIZE = 14;
+}
+
+ProfilerOverlay::ProfilerOverlay()
+    : graph(sf::LineStrip), budgetLine(sf::Lines, 2)
+{
+    background.setFillColor(sf::Color(0, 0, 0, 180));
+    zoneText.setCharacterSize(CHARACTER_SIZE);
+    zoneText.setFillColor(sf::Color::White);
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget& target, const sf::Font& font) {
+    if (!visible) return;
+
+    const sf::View previousView = target.getView();
+    target.setView(target.getDefaultView());
+
+    const float left = target.getSize().x - PANEL_WIDTH - PANEL_MARGIN;
+    const float top = PANEL_MARGIN;
+    const std::vector<float> history = Profiler::getFrameHistory();
+
+    // Zone table, rebuilt on a timer rather than every frame
+    if (!refreshed || refreshClock.getElapsedTime().asSeconds() >= TEXT_REFRESH_SECONDS) {
+        refreshClock.restart();
+        refreshed = true;
+
+        float average = 0.f;
+        float worst = 0.f;
+        for (float ms : history) {
+            average += ms;
+            worst = std::max(worst, ms);
+        }
+        if (!history.empty()) average /= history.size();
+
+        char line[128];
+        std::snprintf(line, sizeof(line), "frame %llu  avg %.2f ms  max %.2f ms\n",
+            static_cast<unsigned long long>(Profiler::getFrameIndex()), average, worst);
+        std::string text = line;
+
+        for (const auto& zone : Profiler::getLastFrameZones()) {
+            std::snprintf(line, sizeof(line), "%*s%-28s %7.3f ms  x%u\n",
+                static_cast<int>(zone.depth * 2), "", zone.name, zone.milliseconds, zone.calls);
+            text += line;
+        }
+#if !PROFILER_ENABLED
+        text += "(zones compiled out)\n";
+#endif
+        zoneText.setFont(font);
+        zoneText.setString(text);
+    }
+
+    const sf::FloatRect textBounds = zoneText.getLocalBounds();
+    const float graphTop = top + textBounds.top + textBounds.height + 2.f * PANEL_MARGIN;
+
+    background.setPosition(left - PANEL_MARGIN / 2.f, top - PANEL_MARGIN / 2.f);
+    background.setSize(sf::Vector2f(PANEL_WIDTH + PANEL_MARGIN, graphTop + GRAPH_HEIGHT - top + PANEL_MARGIN));
+    zoneText.setPosition(left, top);
+
+    // Frame time graph, newest on the right
+    const float step = PANEL_WIDTH / static_cast<float>(Profiler::FRAME_HISTORY - 1);
+    const float graphBottom = graphTop + GRAPH_HEIGHT;
+    const float firstX = left + PANEL_WIDTH - step * (history.size() > 0 ? history.size() - 1 : 0);
+
+    graph.resize(history.size());
+    for (size_t i = 0; i < history.size(); ++i) {
+        const float ms = std::min(history[i], GRAPH_MAX_MS);
+        graph[i].position = sf::Vector2f(firstX + step * i, graphBottom - ms / GRAPH_MAX_MS * GRAPH_HEIGHT);
+        graph[i].color = history[i] > FRAME_BUDGET_MS ? sf::Color::Red : sf::Color::Green;
+    }
+
+    const float budgetY = graphBottom - FRAME_BUDGET_MS / GRAPH_MAX_MS * GRAPH_HEIGHT;
+    budgetLine[0] = sf::Vertex(sf::Vector2f(left, budgetY), sf::Color(255, 255, 0, 128));
+    budgetLine[1] = sf::Vertex(sf::Vector2f(left + PANEL_WIDTH, budgetY), sf::Color(255, 255, 0, 128));
+
+    target.draw(background);
+    target.draw(zoneText);
+    target.draw(budgetLine);
+    target.draw(graph);
+
+    target.setView(previousView);
+}
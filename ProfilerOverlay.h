@@ -0,0 +1,25 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// In-game view of the Profiler: per-zone milliseconds of the last frame and a graph of recent
+// frame times against the 60 fps budget. The zone text refreshes a few times a second so it stays readable.
+class ProfilerOverlay {
+public:
+    ProfilerOverlay();
+
+    void toggle() { visible = !visible; }
+    bool isVisible() const { return visible; }
+
+    // Draw in window pixels at the top-right corner
+    void draw(sf::RenderTarget& target, const sf::Font& font);
+
+private:
+    bool visible = false;
+
+    sf::RectangleShape background;
+    sf::Text zoneText;
+    sf::VertexArray graph;             // One line strip of recent frame times
+    sf::VertexArray budgetLine;        // 16.7 ms reference
+    sf::Clock refreshClock;
+    bool refreshed = false;
+};
@@ -0,0 +1,106 @@
+#include "Random.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Batch fill with raw 64-bit values
+void RandomStream::fill(std::uint64_t* out, size_t count) {
+    const std::uint64_t start = counter;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = at(start + i);
+    }
+    counter = start + count;
+}
+
+// Batch fill with unbiased integers in [0, range)
+void RandomStream::fillBelow(std::uint32_t* out, size_t count, std::uint32_t range) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = below(range);
+    }
+}
+
+// Batch fill with floats in [0, 1)
+void RandomStream::fillUnit(float* out, size_t count) {
+    const std::uint64_t start = counter;
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<float>(at(start + i) >> 40) * (1.f / 16777216.f);
+    }
+    counter = start + count;
+}
+
+namespace {
+    constexpr size_t STREAM_COUNT = 4;
+
+    // Tags separating the families of streams derived from the run seed
+    constexpr std::uint64_t NAMED_TAG = 1;
+    constexpr std::uint64_t CARD_TAG = 2;
+    constexpr std::uint64_t THREAD_TAG = 3;
+
+    std::uint64_t runSeed = 0;
+    std::array<RandomStream, STREAM_COUNT> namedStreams;
+    bool seeded = false;
+
+    std::atomic<std::uint64_t> nextThreadOrdinal{ 0 };
+
+    // Seed the run lazily so streams work even if nobody called setRunSeed
+    void ensureSeeded() {
+        if (!seeded) Random::setRunSeed(Random::makeSeed());
+    }
+}
+
+namespace Random {
+    // Seed from the SCRATCH_SEED environment variable if set, otherwise from the clock and random_device
+    std::uint64_t makeSeed() {
+        if (const char* env = std::getenv("SCRATCH_SEED")) {
+            return std::strtoull(env, nullptr, 10);
+        }
+
+        std::random_device device;
+        const std::uint64_t entropy = (static_cast<std::uint64_t>(device()) << 32) | device();
+        const std::uint64_t time = static_cast<std::uint64_t>(
+            std::chrono::high_resolution_clock::now().time_since_epoch().count());
+        return RandomStream::mix(entropy ^ time);
+    }
+
+    // Reset every named stream from a new run seed
+    void setRunSeed(std::uint64_t seed) {
+        runSeed = seed;
+        seeded = true;
+
+        const RandomStream named = RandomStream(seed).derive(NAMED_TAG);
+        for (size_t i = 0; i < STREAM_COUNT; ++i) {
+            namedStreams[i] = named.derive(i);
+        }
+    }
+
+    std::uint64_t getRunSeed() {
+        ensureSeeded();
+        return runSeed;
+    }
+
+    // Named stream derived from the run seed
+    RandomStream& stream(Stream id) {
+        ensureSeeded();
+        return namedStreams[static_cast<size_t>(id)];
+    }
+
+    // Prize stream of one card: a pure function of (runSeed, round, cardIndex)
+    RandomStream card(std::uint64_t seed, int round, int cardIndex) {
+        return RandomStream(seed).derive(CARD_TAG)
+            .derive(static_cast<std::uint64_t>(round))
+            .derive(static_cast<std::uint64_t>(cardIndex));
+    }
+
+    RandomStream card(int round, int cardIndex) {
+        return card(getRunSeed(), round, cardIndex);
+    }
+
+    // Per-thread stream, created on first use in each thread
+    RandomStream& threadLocal() {
+        thread_local RandomStream local = RandomStream(getRunSeed()).derive(THREAD_TAG).derive(nextThreadOrdinal++);
+        return local;
+    }
+}
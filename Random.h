@@ -0,0 +1,105 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Counter-based random stream.
+// Value i of a stream is a pure function of (key, i): the SplitMix64 finalizer applied to
+// key + i * golden gamma. Any position is reachable in O(1), copies are independent, and
+// streams derived from different ids never share state.
+class RandomStream {
+public:
+    RandomStream() = default;
+    explicit RandomStream(std::uint64_t key, std::uint64_t counter = 0) : key(key), counter(counter) {}
+
+    // SplitMix64 finalizer: a strong 64-bit bijective mix
+    static std::uint64_t mix(std::uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Child stream for an id; depends only on this stream's key, not on its position
+    RandomStream derive(std::uint64_t id) const {
+        return RandomStream(mix(key ^ mix(id * 0xD1B54A32D192ED03ull + 0x632BE59BD9B4E019ull)));
+    }
+
+    // Value at any index, without moving the stream
+    std::uint64_t at(std::uint64_t index) const { return mix(key + (index + 1) * 0x9E3779B97F4A7C15ull); }
+
+    // Next 64 random bits
+    std::uint64_t next() { return at(counter++); }
+
+    // Unbiased integer in [0, range), range > 0 (Lemire's multiply-shift with rejection)
+    std::uint32_t below(std::uint32_t range) {
+        std::uint64_t m = (next() >> 32) * range;
+        std::uint32_t low = static_cast<std::uint32_t>(m);
+        if (low < range) {
+            const std::uint32_t threshold = (0u - range) % range;
+            while (low < threshold) {
+                m = (next() >> 32) * range;
+                low = static_cast<std::uint32_t>(m);
+            }
+        }
+        return static_cast<std::uint32_t>(m >> 32);
+    }
+
+    // Unbiased integer in [min, max]
+    int range(int min, int max) {
+        return min + static_cast<int>(below(static_cast<std::uint32_t>(max - min) + 1u));
+    }
+
+    // Float in [0, 1) with 24 bits of precision
+    float unit() { return static_cast<float>(next() >> 40) * (1.f / 16777216.f); }
+
+    // Float in [min, max)
+    float uniform(float min, float max) { return min + unit() * (max - min); }
+
+    // Batch fills; each advances the stream by count values
+    void fill(std::uint64_t* out, size_t count);
+    void fillBelow(std::uint32_t* out, size_t count, std::uint32_t range);
+    void fillUnit(float* out, size_t count);
+
+    std::uint64_t getKey() const { return key; }
+    std::uint64_t getCounter() const { return counter; }
+
+    // Jump to any position in the stream
+    void seek(std::uint64_t position) { counter = position; }
+
+private:
+    std::uint64_t key = 0;
+    std::uint64_t counter = 0;
+};
+
+// Run-wide random streams. Every stream is derived from one run seed, so a run can be
+// replayed from its seed, and consumers never disturb each other's sequences.
+namespace Random {
+    // Named streams for the main thread (not thread-safe; use threadLocal from workers)
+    enum class Stream {
+        General,     // Utils::randInt / randFloat
+        Shop,        // Shop offers and rerolls
+        Prizes,      // Prize rolls not tied to a specific card
+        Particles    // Cosmetic effects
+    };
+
+    // Seed from the SCRATCH_SEED environment variable if set, otherwise from the clock and random_device
+    std::uint64_t makeSeed();
+
+    // Reset every named stream from a new run seed
+    void setRunSeed(std::uint64_t seed);
+    std::uint64_t getRunSeed();
+
+    // Named stream derived from the run seed
+    RandomStream& stream(Stream id);
+
+    inline RandomStream& shop() { return stream(Stream::Shop); }
+    inline RandomStream& prizes() { return stream(Stream::Prizes); }
+    inline RandomStream& particles() { return stream(Stream::Particles); }
+
+    // Prize stream of one card: a pure function of (runSeed, round, cardIndex), O(1) to build
+    RandomStream card(std::uint64_t runSeed, int round, int cardIndex);
+    RandomStream card(int round, int cardIndex);
+
+    // Per-thread stream for parallel tools, derived from the run seed and a per-thread ordinal.
+    // Set the run seed before starting worker threads.
+    RandomStream& threadLocal();
+}
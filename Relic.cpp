@@ -0,0 +1,29 @@
+#include "Relic.h"
+
+// Every relic the game defines
+const std::vector<Relic>& Relic::definitions() {
+    static const std::vector<Relic> relics = {
+        { "lucky_coin", "Lucky Coin", "Increases winnings by 10%", 50,
+            { { RelicStat::Payout, 0.f, 10.f } } },
+        { "golden_ticket", "Golden Ticket", "More lucky 7s and bigger multipliers", 100,
+            { { RelicStat::MoneyChance, 5.f, 0.f }, { RelicStat::MultiplierMin, 0.25f, 0.f } } },
+        { "mystery_box", "Mystery Box", "Shop prices -20%, quotas +10%", 75,
+            { { RelicStat::ShopPrice, 0.f, -20.f }, { RelicStat::Quota, 0.f, 10.f } } }
+    };
+    return relics;
+}
+
+// Table from catalog index to definition, built once the definitions are interned
+const Relic* Relic::find(RelicId id) {
+    static const std::vector<const Relic*> byIndex = [] {
+        std::vector<const Relic*> table;
+        for (const Relic& relic : definitions()) {
+            const RelicId relicId = Catalog::relicId(relic.id);
+            if (relicId.index >= table.size()) table.resize(relicId.index + 1, nullptr);
+            table[relicId.index] = &relic;
+        }
+        return table;
+    }();
+
+    return id.index < byIndex.size() ? byIndex[id.index] : nullptr;
+}
@@ -1,9 +1,36 @@
 #pragma once
 #include <string>
+#include <vector>
+#include "Catalog.h"
+
+// Game values a relic can change
+enum class RelicStat {
+	MoneyChance,     // Percent of zones rolled as lucky 7s
+	NoneChance,      // Percent of zones rolled empty
+	MultiplierMin,   // Smallest multiplier prize
+	Payout,          // Card rewards (flat amounts only raise winning entries)
+	ShopPrice,       // Price of every shop item
+	Quota,           // Money needed to pass a round
+	Count
+};
+
+// One effect of a relic, applied once per copy owned: value = (base + add) * (100 + percent) / 100
+struct RelicModifier {
+	RelicStat stat = RelicStat::Payout;
+	float add = 0.f;
+	float percent = 0.f;
+};
 
 struct Relic {
 	std::string id;
 	std::string name;
 	std::string description;
 	int cost;
-};
\ No newline at end of file
+	std::vector<RelicModifier> modifiers;
+
+	// Every relic the game defines
+	static const std::vector<Relic>& definitions();
+
+	// Definition of an owned relic; nullptr for IDs with no definition (they have no effect)
+	static const Relic* find(RelicId id);
+};
@@ -0,0 +1,54 @@
+#include "RelicPlan.h"
+#include "Player.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cmath>
+
+RelicPlan::RelicPlan(const PrizeRules& baseRules)
+    : baseRules(&baseRules), rules(baseRules) {}
+
+bool RelicPlan::update(const Player& player) {
+    if (compiled && player.getRelicsVersion() == compiledVersion) return false;
+
+    compile(player);
+    return true;
+}
+
+void RelicPlan::compile(const Player& player) {
+    adds.fill(0.f);
+    percents.fill(0.f);
+
+    for (RelicId id : player.getRelics()) {
+        const Relic* relic = Relic::find(id);
+        if (!relic) continue;
+
+        const float stack = static_cast<float>(player.getRelicStack(id));
+        for (const RelicModifier& modifier : relic->modifiers) {
+            const size_t index = static_cast<size_t>(modifier.stat);
+            adds[index] += modifier.add * stack;
+            percents[index] += modifier.percent * stack;
+        }
+    }
+
+    // Odds stay within [0, 100] with money taking precedence over empty zones
+    rules = *baseRules;
+    rules.moneyChance = std::clamp(static_cast<int>(std::lround(apply(RelicStat::MoneyChance, static_cast<float>(rules.moneyChance)))), 0, 100);
+    rules.noneChance = std::clamp(static_cast<int>(std::lround(apply(RelicStat::NoneChance, static_cast<float>(rules.noneChance)))), 0, 100 - rules.moneyChance);
+    rules.multiplierMin = std::max(0.f, apply(RelicStat::MultiplierMin, rules.multiplierMin));
+
+    // Payout modifiers are baked into the reward table, so a card's payout stays one lookup
+    for (int& reward : rules.lucky7Rewards) {
+        if (reward > 0) reward = scaled(RelicStat::Payout, reward);
+    }
+
+    compiled = true;
+    compiledVersion = player.getRelicsVersion();
+
+    LOG_DEBUG(Prizes, "Relic plan compiled", { { "relics", player.getRelicTotal() }, { "moneyChance", rules.moneyChance },
+        { "noneChance", rules.noneChance }, { "multiplierMin", rules.multiplierMin }, { "maxReward", rules.maxBaseReward() } });
+}
+
+int RelicPlan::scaled(RelicStat stat, int value) const {
+    return std::max(0, static_cast<int>(std::lround(apply(stat, static_cast<float>(value)))));
+}
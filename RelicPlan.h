@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include "PrizeRules.h"
+#include "Relic.h"
+
+class Player;
+
+// Relic modifiers flattened into the values the game reads per card, per shop item and per round.
+// compile() walks the owned relics once, whenever the relic set changes; reads in between are a
+// precomputed field or table entry, however many relics are stacked.
+class RelicPlan {
+public:
+    // Odds and payouts the relics modify (must outlive the plan); defaults to PrizeRules::standard()
+    explicit RelicPlan(const PrizeRules& baseRules = PrizeRules::standard());
+
+    // Recompile if the player's relic set changed since the last compile; returns true if it did
+    bool update(const Player& player);
+
+    // Fold the modifiers of every owned relic, times its stack, into the base values
+    void compile(const Player& player);
+
+    // Prize odds and reward table with every relic applied, for ScratchCard::setRules.
+    // Recompiling updates it in place, so cards holding it see the new payouts.
+    const PrizeRules& getRules() const { return rules; }
+
+    int getShopPrice(int basePrice) const { return scaled(RelicStat::ShopPrice, basePrice); }
+    int getQuota(int baseQuota) const { return scaled(RelicStat::Quota, baseQuota); }
+
+private:
+    static constexpr size_t STAT_COUNT = static_cast<size_t>(RelicStat::Count);
+
+    float apply(RelicStat stat, float value) const {
+        const size_t index = static_cast<size_t>(stat);
+        return (value + adds[index]) * (100.f + percents[index]) / 100.f;
+    }
+
+    // Rounded and clamped at zero
+    int scaled(RelicStat stat, int value) const;
+
+    const PrizeRules* baseRules;
+    PrizeRules rules;
+
+    // Summed modifiers per stat
+    std::array<float, STAT_COUNT> adds{};
+    std::array<float, STAT_COUNT> percents{};
+
+    bool compiled = false;
+    std::uint32_t compiledVersion = 0;   // Player relic version the plan was built from
+};
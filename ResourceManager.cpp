@@ -1,4 +1,161 @@
 #include "ResourceManager.h"
+#include "AssetPack.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+    constexpr unsigned int MAX_DECODE_THREADS = 4;
+
+    // A texture file waiting to be decoded
+    struct DecodeJob {
+        std::string name;
+        std::string filename;
+        bool atlas = false;
+        const AssetPack::Entry* baked = nullptr;   // Pack entry to use instead, if it is still fresh
+        std::promise<bool> done;
+    };
+
+    // A decoded image waiting for its GPU upload on the render thread.
+    // Pixels come from the asset pack mapping when baked is set, otherwise from image.
+    struct DecodedTexture {
+        std::string name;
+        std::string filename;
+        bool atlas = false;
+        const AssetPack::Entry* baked = nullptr;
+        std::unique_ptr<sf::Image> image;   // Null if decoding failed
+        std::promise<bool> done;
+
+        bool isValid() const { return baked || image; }
+
+        unsigned int getWidth() const { return baked ? baked->width : (image ? image->getSize().x : 0); }
+        unsigned int getHeight() const { return baked ? baked->height : (image ? image->getSize().y : 0); }
+
+        const sf::Uint8* getPixels() const { return baked ? AssetPack::getPixels(*baked) : image->getPixelsPtr(); }
+        size_t getStride() const { return baked ? AssetPack::getStride(*baked) : static_cast<size_t>(getWidth()) * 4; }
+
+        size_t getBytes() const { return static_cast<size_t>(getWidth()) * getHeight() * 4; }
+    };
+
+    // Worker threads decoding image files off the render thread.
+    // sf::Image is CPU-only, so decoding needs no GL context; uploads stay on the render thread.
+    class DecodePool {
+    public:
+        ~DecodePool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            jobAvailable.notify_all();
+            for (auto& worker : workers) worker.join();
+        }
+
+        // Queue a file, starting the workers on first use
+        void submit(DecodeJob job) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (workers.empty()) {
+                    const unsigned int count = std::min(MAX_DECODE_THREADS, std::max(1u, std::thread::hardware_concurrency()));
+                    for (unsigned int i = 0; i < count; ++i) workers.emplace_back(&DecodePool::workerLoop, this);
+                }
+                jobs.push_back(std::move(job));
+            }
+            jobAvailable.notify_one();
+        }
+
+        // Take the oldest decoded image if its upload fits in budget bytes
+        bool takeDecoded(size_t budget, DecodedTexture& out) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (decoded.empty() || decoded.front().getBytes() > budget) return false;
+
+            out = std::move(decoded.front());
+            decoded.pop_front();
+            return true;
+        }
+
+    private:
+        void workerLoop() {
+            for (;;) {
+                DecodeJob job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    jobAvailable.wait(lock, [this] { return stopping || !jobs.empty(); });
+                    if (stopping) return;
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                }
+                PROFILE_ZONE("DecodePool::decode");
+
+                DecodedTexture result;
+                result.name = std::move(job.name);
+                result.filename = std::move(job.filename);
+                result.atlas = job.atlas;
+                result.done = std::move(job.done);
+
+                // Baked pixels skip decoding entirely, unless the loose file has changed since baking
+                if (job.baked && AssetPack::isFresh(*job.baked, result.filename)) {
+                    result.baked = job.baked;
+                }
+                else {
+                    if (job.baked) LOG_INFO(Resources, "Asset pack entry is stale, decoding file", { { "path", result.filename } });
+
+                    result.image = std::make_unique<sf::Image>();
+                    if (!result.image->loadFromFile(result.filename)) result.image.reset();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                decoded.push_back(std::move(result));
+            }
+        }
+
+        std::mutex mutex;                        // Guards jobs, decoded and stopping
+        std::condition_variable jobAvailable;
+        std::deque<DecodeJob> jobs;
+        std::deque<DecodedTexture> decoded;
+        std::vector<std::thread> workers;
+        bool stopping = false;
+    };
+
+    DecodePool& decodePool() {
+        static DecodePool pool;
+        return pool;
+    }
+
+    // Decoded atlas entries held until the rest of their batch has decoded (render thread only)
+    std::vector<DecodedTexture> pendingAtlas;
+
+    // Baked atlas pages already uploaded, by pack entry index (render thread only)
+    std::unordered_map<std::uint32_t, const sf::Texture*> bakedPageTextures;
+
+#ifndef NDEBUG
+    // Lookups by name, for reportStringLookups
+    std::unordered_map<std::string, size_t> stringLookupCounts;
+#endif
+
+    // Debug builds: count a lookup by name
+    inline void countStringLookup(const std::string& name) {
+#ifndef NDEBUG
+        ++stringLookupCounts[name];
+#else
+        (void)name;
+#endif
+    }
+
+    // Whole-texture region
+    TextureRegion wholeTexture(const sf::Texture& texture) {
+        const sf::Vector2u size = texture.getSize();
+        return { &texture, sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y)) };
+    }
+}
 
 // Static member definitions
 std::unordered_map<std::string, sf::Font> ResourceManager::fonts;
@@ -10,17 +167,30 @@ sf::Texture ResourceManager::defaultTexture;
 bool ResourceManager::defaultFontLoaded = false;
 bool ResourceManager::defaultTextureLoaded = false;
 
+LoadProgress ResourceManager::progress;
+
+std::vector<std::unique_ptr<sf::Texture>> ResourceManager::atlasPages;
+
+std::unordered_map<std::string, std::uint32_t> ResourceManager::textureIds;
+std::vector<TextureRegion> ResourceManager::textureRegions;
+std::unordered_map<std::string, std::uint32_t> ResourceManager::fontIds;
+std::vector<sf::Font*> ResourceManager::fontSlots;
+
+TextureRegion ResourceManager::defaultRegion{ &ResourceManager::defaultTexture, sf::IntRect() };
+
 bool ResourceManager::loadFont(const std::string& name, const std::string& filename) {
     sf::Font font;
     if (!font.loadFromFile(filename)) {
-        std::cerr << "[Error] Failed to load font: " << filename << std::endl;
+        LOG_ERROR(Resources, "Failed to load font", { { "path", filename } });
         return false;
     }
-    fonts[name] = std::move(font);
+    sf::Font& stored = fonts[name];
+    stored = std::move(font);
+    fontSlots[fontId(name).index] = &stored;
 
     // Set default font if none loaded yet
     if (!defaultFontLoaded) {
-        defaultFont = fonts[name];
+        defaultFont = stored;
         defaultFontLoaded = true;
     }
 
@@ -28,14 +198,15 @@ bool ResourceManager::loadFont(const std::string& name, const std::string& filen
 }
 
 sf::Font& ResourceManager::getFont(const std::string& name) {
+    countStringLookup(name);
     auto it = fonts.find(name);
     if (it != fonts.end()) {
         return it->second;
     }
     else {
-        std::cerr << "[Warning] Font not found: " << name << ". Returning default font." << std::endl;
+        LOG_WARN(Resources, "Font not found, returning default font", { { "name", name } });
         if (!defaultFontLoaded) {
-            std::cerr << "[Error] Default font not loaded! Returning empty font." << std::endl;
+            LOG_ERROR(Resources, "Default font not loaded, returning empty font");
         }
         return defaultFont;
     }
@@ -44,31 +215,303 @@ sf::Font& ResourceManager::getFont(const std::string& name) {
 bool ResourceManager::loadTexture(const std::string& name, const std::string& filename) {
     sf::Texture texture;
     if (!texture.loadFromFile(filename)) {
-        std::cerr << "[Error] Failed to load texture: " << filename << std::endl;
+        LOG_ERROR(Resources, "Failed to load texture", { { "path", filename } });
         return false;
     }
 
-    textures[name] = std::move(texture);
-
-    // Set default texture if none loaded yet
-    if (!defaultTextureLoaded) {
-        defaultTexture = textures[name];
-        defaultTextureLoaded = true;
-    }
+    sf::Texture& stored = textures[name];
+    stored = std::move(texture);
+    setRegion(name, wholeTexture(stored));
+    setDefaultTexture(stored);
 
     return true;
 }
 
 sf::Texture& ResourceManager::getTexture(const std::string& name) {
+    countStringLookup(name);
     auto it = textures.find(name);
     if (it != textures.end()) {
         return it->second;
     }
     else {
-        std::cerr << "[Warning] Texture not found: " << name << ". Returning default texture." << std::endl;
+        LOG_WARN(Resources, "Texture not found, returning default texture", { { "name", name } });
         if (!defaultTextureLoaded) {
-            std::cerr << "[Error] Default texture not loaded! Returning empty texture." << std::endl;
+            LOG_ERROR(Resources, "Default texture not loaded, returning empty texture");
         }
         return defaultTexture;
     }
 }
+
+std::vector<std::shared_future<bool>> ResourceManager::loadTexturesAsync(const std::vector<TextureRequest>& batch) {
+    // A new batch after everything finished starts a fresh progress count
+    if (progress.isDone()) progress = LoadProgress();
+    progress.requested += batch.size();
+
+    std::vector<std::shared_future<bool>> results;
+    results.reserve(batch.size());
+    for (const auto& request : batch) {
+        // Atlas entries can come from a baked region or a baked image; standalone textures need a baked image
+        const AssetPack::Entry* baked = AssetPack::find(request.filename);
+        if (baked && !(baked->kind == AssetPack::Kind::Image
+            || (request.atlas && baked->kind == AssetPack::Kind::AtlasRegion))) {
+            baked = nullptr;
+        }
+
+        DecodeJob job{ request.name, request.filename, request.atlas, baked, std::promise<bool>() };
+        results.push_back(job.done.get_future().share());
+        decodePool().submit(std::move(job));
+    }
+
+    LOG_DEBUG(Resources, "Queued texture batch", { { "count", batch.size() } });
+    return results;
+}
+
+size_t ResourceManager::finalizeUploads(size_t byteBudget) {
+    PROFILE_ZONE("ResourceManager::finalizeUploads");
+    size_t finished = 0;
+    size_t uploadedBytes = 0;
+
+    DecodedTexture item;
+    for (;;) {
+        const size_t remaining = finished == 0 ? std::numeric_limits<size_t>::max()
+            : (uploadedBytes < byteBudget ? byteBudget - uploadedBytes : 0);
+        if (!decodePool().takeDecoded(remaining, item)) break;
+
+        // Atlas entries wait until their whole batch can be packed together
+        if (item.atlas && item.isValid()) {
+            pendingAtlas.push_back(std::move(item));
+            continue;
+        }
+
+        uploadedBytes += item.getBytes();
+        const bool loaded = item.isValid() && storeTexture(item.name, item.getPixels(), item.getWidth(), item.getHeight());
+        finishRequest(item.filename, loaded);
+        item.done.set_value(loaded);
+        ++finished;
+    }
+
+    // Everything else requested has finished, so the held atlas entries are all there is to pack
+    if (!pendingAtlas.empty() && progress.completed + pendingAtlas.size() == progress.requested) {
+        finished += pendingAtlas.size();
+        buildAtlasPages();
+    }
+
+    if (finished > 0) {
+        LOG_DEBUG(Resources, "Finalized texture uploads", { { "count", finished }, { "bytes", uploadedBytes },
+            { "completed", progress.completed }, { "requested", progress.requested } });
+    }
+    return finished;
+}
+
+LoadProgress ResourceManager::getLoadProgress() {
+    return progress;
+}
+
+TextureRegion ResourceManager::getRegion(const std::string& name) {
+    countStringLookup(name);
+    auto it = textureIds.find(name);
+    if (it != textureIds.end() && textureRegions[it->second].texture) {
+        return textureRegions[it->second];
+    }
+
+    LOG_WARN(Resources, "Texture not found, returning default texture", { { "name", name } });
+    return defaultRegion;
+}
+
+void ResourceManager::setSpriteTexture(sf::Sprite& sprite, const std::string& name) {
+    const TextureRegion region = getRegion(name);
+    sprite.setTexture(*region.texture);
+    sprite.setTextureRect(region.rect);
+}
+
+void ResourceManager::buildAtlasPages() {
+    const unsigned int maxPageSize = std::min(TextureAtlas::MAX_PAGE_SIZE, sf::Texture::getMaximumSize());
+
+    // Entries baked onto a pack atlas page this GPU can hold use that page as is;
+    // everything else is packed now
+    std::vector<TextureAtlas::Input> inputs;
+    std::vector<size_t> packedItems;
+    std::vector<bool> onBakedPage(pendingAtlas.size(), false);
+    for (size_t i = 0; i < pendingAtlas.size(); ++i) {
+        const DecodedTexture& item = pendingAtlas[i];
+        if (item.baked && item.baked->kind == AssetPack::Kind::AtlasRegion) {
+            const AssetPack::Entry* page = AssetPack::getEntry(item.baked->page);
+            if (page->width <= maxPageSize && page->height <= maxPageSize) {
+                onBakedPage[i] = true;
+                continue;
+            }
+        }
+
+        inputs.push_back({ item.getPixels(), item.getWidth(), item.getHeight(), item.getStride() });
+        packedItems.push_back(i);
+    }
+
+    const TextureAtlas::Result packed = TextureAtlas::pack(inputs, maxPageSize, TextureAtlas::PADDING);
+
+    // Upload the new pages
+    const size_t firstPage = atlasPages.size();
+    std::vector<bool> pageLoaded;
+    for (const auto& page : packed.pages) {
+        pageLoaded.push_back(uploadAtlasPage(page.rgba.data(), page.width, page.height) != nullptr);
+    }
+
+    std::vector<bool> loaded(pendingAtlas.size(), false);
+    for (size_t k = 0; k < packedItems.size(); ++k) {
+        DecodedTexture& item = pendingAtlas[packedItems[k]];
+        const TextureAtlas::Placement& placement = packed.placements[k];
+
+        if (placement.packed) {
+            if (pageLoaded[placement.page]) {
+                setRegion(item.name, { atlasPages[firstPage + placement.page].get(),
+                    sf::IntRect(placement.left, placement.top, placement.width, placement.height) });
+                loaded[packedItems[k]] = true;
+            }
+        }
+        else {
+            // Too large for a page; keep it as a texture of its own
+            loaded[packedItems[k]] = storeTexture(item.name, item.getPixels(), item.getWidth(), item.getHeight());
+        }
+    }
+
+    // Baked regions: upload each baked page once, straight from the mapping
+    size_t bakedCount = 0;
+    for (size_t i = 0; i < pendingAtlas.size(); ++i) {
+        if (!onBakedPage[i]) continue;
+        const DecodedTexture& item = pendingAtlas[i];
+
+        const std::uint32_t pageIndex = item.baked->page;
+        auto it = bakedPageTextures.find(pageIndex);
+        if (it == bakedPageTextures.end()) {
+            const AssetPack::Entry* page = AssetPack::getEntry(pageIndex);
+            it = bakedPageTextures.emplace(pageIndex, uploadAtlasPage(AssetPack::getPixels(*page), page->width, page->height)).first;
+        }
+
+        if (it->second) {
+            setRegion(item.name, { it->second,
+                sf::IntRect(item.baked->left, item.baked->top, static_cast<int>(item.baked->width), static_cast<int>(item.baked->height)) });
+            loaded[i] = true;
+        }
+        ++bakedCount;
+    }
+
+    for (size_t i = 0; i < pendingAtlas.size(); ++i) {
+        finishRequest(pendingAtlas[i].filename, loaded[i]);
+        pendingAtlas[i].done.set_value(loaded[i]);
+    }
+
+    LOG_INFO(Resources, "Built texture atlas", { { "textures", pendingAtlas.size() }, { "baked", bakedCount },
+        { "newPages", packed.pages.size() } });
+    pendingAtlas.clear();
+}
+
+const sf::Texture* ResourceManager::uploadAtlasPage(const sf::Uint8* rgba, unsigned int width, unsigned int height) {
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->create(width, height)) {
+        LOG_ERROR(Resources, "Failed to create atlas page", { { "width", width }, { "height", height } });
+        return nullptr;
+    }
+    texture->update(rgba);
+    texture->setSmooth(false);
+
+    atlasPages.push_back(std::move(texture));
+    return atlasPages.back().get();
+}
+
+bool ResourceManager::storeTexture(const std::string& name, const sf::Uint8* rgba, unsigned int width, unsigned int height) {
+    // Upload straight into the map entry; sf::Texture copies are GPU copies
+    const bool existed = textures.count(name) > 0;
+    sf::Texture& texture = textures[name];
+    if (!texture.create(width, height)) {
+        if (!existed) textures.erase(name);
+        return false;
+    }
+    texture.update(rgba);
+
+    setRegion(name, wholeTexture(texture));
+    setDefaultTexture(texture);
+    return true;
+}
+
+void ResourceManager::finishRequest(const std::string& filename, bool loaded) {
+    if (!loaded) {
+        LOG_ERROR(Resources, "Failed to load texture", { { "path", filename } });
+        ++progress.failed;
+    }
+    ++progress.completed;
+}
+
+TextureId ResourceManager::textureId(const std::string& name) {
+    auto it = textureIds.find(name);
+    if (it != textureIds.end()) {
+        return { it->second };
+    }
+
+    const std::uint32_t index = static_cast<std::uint32_t>(textureRegions.size());
+    textureIds.emplace(name, index);
+    textureRegions.emplace_back();
+    return { index };
+}
+
+FontId ResourceManager::fontId(const std::string& name) {
+    auto it = fontIds.find(name);
+    if (it != fontIds.end()) {
+        return { it->second };
+    }
+
+    const std::uint32_t index = static_cast<std::uint32_t>(fontSlots.size());
+    fontIds.emplace(name, index);
+    fontSlots.push_back(nullptr);
+    return { index };
+}
+
+TextureRegion ResourceManager::getRegion(TextureId id) {
+    if (id.index < textureRegions.size() && textureRegions[id.index].texture) {
+        return textureRegions[id.index];
+    }
+    return defaultRegion;
+}
+
+const sf::Texture& ResourceManager::getTexture(TextureId id) {
+    return *getRegion(id).texture;
+}
+
+sf::Font& ResourceManager::getFont(FontId id) {
+    if (id.index < fontSlots.size() && fontSlots[id.index]) {
+        return *fontSlots[id.index];
+    }
+    return defaultFont;
+}
+
+void ResourceManager::setSpriteTexture(sf::Sprite& sprite, TextureId id) {
+    const TextureRegion region = getRegion(id);
+    sprite.setTexture(*region.texture);
+    sprite.setTextureRect(region.rect);
+}
+
+void ResourceManager::reportStringLookups() {
+#ifndef NDEBUG
+    std::vector<std::pair<std::string, size_t>> repeated;
+    for (const auto& entry : stringLookupCounts) {
+        if (entry.second > 1) repeated.push_back(entry);
+    }
+    std::sort(repeated.begin(), repeated.end(),
+        [](const auto& a, const auto& b) { return a.second != b.second ? a.second > b.second : a.first < b.first; });
+
+    LOG_INFO(Resources, "Repeated string lookups (use a TextureId/FontId)", { { "names", repeated.size() } });
+    for (const auto& entry : repeated) {
+        LOG_INFO(Resources, "String lookup", { { "name", entry.first }, { "count", entry.second } });
+    }
+#endif
+}
+
+void ResourceManager::setRegion(const std::string& name, const TextureRegion& region) {
+    textureRegions[textureId(name).index] = region;
+}
+
+void ResourceManager::setDefaultTexture(const sf::Texture& texture) {
+    if (defaultTextureLoaded) return;
+
+    defaultTexture = texture;
+    defaultRegion = wholeTexture(defaultTexture);
+    defaultTextureLoaded = true;
+}
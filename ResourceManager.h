@@ -1,10 +1,55 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <future>
+#include <memory>
 #include <unordered_map>
 #include <string>
-#include <iostream>
+#include <vector>
 
-// Static resource loader and cache manager for fonts and textures
+// Texture to load asynchronously: the name to store it under and the file to decode
+struct TextureRequest {
+    std::string name;
+    std::string filename;
+    bool atlas = false;     // Pack onto a shared atlas page instead of a texture of its own
+};
+
+// Where a texture's pixels live: a whole texture, or a sub-rect of an atlas page
+struct TextureRegion {
+    const sf::Texture* texture = nullptr;
+    sf::IntRect rect;
+};
+
+// Interned texture name: resolved once, then indexes ResourceManager's region table directly,
+// so per-frame access costs no hashing or string allocation
+struct TextureId {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;
+    std::uint32_t index = INVALID;
+
+    bool isValid() const { return index != INVALID; }
+};
+
+// Interned font name (see TextureId)
+struct FontId {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;
+    std::uint32_t index = INVALID;
+
+    bool isValid() const { return index != INVALID; }
+};
+
+// Progress of the asynchronous loads requested since loading last went idle
+struct LoadProgress {
+    size_t requested = 0;
+    size_t completed = 0;   // Uploaded or failed
+    size_t failed = 0;
+
+    bool isDone() const { return completed == requested; }
+    float getFraction() const { return requested == 0 ? 1.f : static_cast<float>(completed) / requested; }
+};
+
+// Static resource loader and cache manager for fonts and textures.
+// Names are interned into TextureId / FontId handles; use the handle overloads in per-frame code
+// and keep the string overloads for setup. Debug builds count string lookups (reportStringLookups).
 class ResourceManager {
 public:
     // Load a font from file and store it with the given name
@@ -19,6 +64,46 @@ public:
     // Retrieve a loaded texture by name; returns default texture if not found
     static sf::Texture& getTexture(const std::string& name);
 
+    // Queue a batch of textures. Files are decoded in parallel on worker threads, then uploaded
+    // to the GPU by finalizeUploads on the render thread. Each future becomes true once the
+    // texture can be fetched with getTexture, or false if it failed to load.
+    static std::vector<std::shared_future<bool>> loadTexturesAsync(const std::vector<TextureRequest>& batch);
+
+    // Upload decoded textures until about byteBudget bytes have gone to the GPU (always at least
+    // one texture, so large images still progress). Call once per frame from the render thread;
+    // returns the number of requests finished.
+    static size_t finalizeUploads(size_t byteBudget);
+
+    // Progress of asynchronous loads, for loading screens
+    static LoadProgress getLoadProgress();
+
+    // Page and sub-rect of a texture; works for atlas entries and standalone textures alike
+    static TextureRegion getRegion(const std::string& name);
+
+    // Point a sprite at a texture's region (page texture and sub-rect)
+    static void setSpriteTexture(sf::Sprite& sprite, const std::string& name);
+
+    // Make name (and its handle) resolve to a region of a texture the caller owns and keeps alive;
+    // for textures created at runtime rather than loaded from a file
+    static void registerRegion(const std::string& name, const TextureRegion& region) { setRegion(name, region); }
+
+    // Number of atlas pages created so far
+    static size_t getAtlasPageCount() { return atlasPages.size(); }
+
+    // Intern a name. The same name always gives the same handle, and handles may be taken
+    // before the resource loads; they resolve to it once it does.
+    static TextureId textureId(const std::string& name);
+    static FontId fontId(const std::string& name);
+
+    // O(1) access by handle; unloaded or invalid handles give the default texture or font
+    static TextureRegion getRegion(TextureId id);
+    static const sf::Texture& getTexture(TextureId id);   // For atlas entries, the whole page
+    static sf::Font& getFont(FontId id);
+    static void setSpriteTexture(sf::Sprite& sprite, TextureId id);
+
+    // Debug builds: log every name looked up by string more than once, most frequent first
+    static void reportStringLookups();
+
 private:
     // Resource storage
     static std::unordered_map<std::string, sf::Font> fonts;
@@ -30,4 +115,37 @@ private:
 
     static bool defaultFontLoaded;
     static bool defaultTextureLoaded;
+
+    // Async load counters (render thread only)
+    static LoadProgress progress;
+
+    // Atlas pages, heap-allocated so regions keep valid pointers
+    static std::vector<std::unique_ptr<sf::Texture>> atlasPages;
+
+    // Interned names and what each handle currently resolves to (texture is null until loaded)
+    static std::unordered_map<std::string, std::uint32_t> textureIds;
+    static std::vector<TextureRegion> textureRegions;
+    static std::unordered_map<std::string, std::uint32_t> fontIds;
+    static std::vector<sf::Font*> fontSlots;
+
+    // Whole default texture, returned for unresolved handles
+    static TextureRegion defaultRegion;
+
+    // Point name's handle at where its pixels now live
+    static void setRegion(const std::string& name, const TextureRegion& region);
+
+    // Make texture the default if none is set yet
+    static void setDefaultTexture(const sf::Texture& texture);
+
+    // Place every decoded atlas request: onto its baked pack page if it has one, otherwise onto new pages
+    static void buildAtlasPages();
+
+    // Upload an atlas page and keep it in atlasPages; returns nullptr on failure
+    static const sf::Texture* uploadAtlasPage(const sf::Uint8* rgba, unsigned int width, unsigned int height);
+
+    // Upload RGBA pixels as a texture of its own under name
+    static bool storeTexture(const std::string& name, const sf::Uint8* rgba, unsigned int width, unsigned int height);
+
+    // Count a finished async request, logging it if it failed
+    static void finishRequest(const std::string& filename, bool loaded);
 };
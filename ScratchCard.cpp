@@ -1,56 +1,47 @@
 #include "ScratchCard.h"
 #include "Prize.h"
 #include "Player.h"
-#include "Utils.h"
 #include "ResourceManager.h"
+#include "Log.h"
+#include "Profiler.h"
 
-#include <iostream>
+#include <algorithm>
 #include <cmath>
-#include <queue>
-#include <random>
+#include <limits>
 #include <sstream>
 #include <iomanip>
 
-// Constructor: load card textures, initialize sprites, and prepare zones/prizes
+// Constructor: share the card template, initialize sprites, and prepare zones
 ScratchCard::ScratchCard(const std::string& cardPath, const std::string& overlayPath, float scale)
-    : scale(scale), fullyRevealed(false), accumulatedMoney(0), accumulatedMultiplier(1.f), winningsApplied(false)
+    : ScratchCard(CardTemplate::get(cardPath, overlayPath), scale)
+{
+}
+
+ScratchCard::ScratchCard(std::shared_ptr<const CardTemplate> sharedTemplate, float scale)
+    : cardTemplate(std::move(sharedTemplate)),
+    model(cardTemplate->getLayout()),
+    scale(scale)
 {
     static bool fontLoaded = false;
 
     // Load main font once for text rendering elsewhere
     if (!fontLoaded && !ResourceManager::loadFont("main", "assets/fonts/retro.ttf")) {
-        std::cerr << "[Error] Failed to load 'main' font in ScratchCard.\n";
+        LOG_ERROR(Resources, "Failed to load 'main' font in ScratchCard");
     }
     fontLoaded = true;
 
-    // Load base card texture and setup sprite
-    cardTexture.loadFromFile(cardPath);
-    cardTexture.setSmooth(false);
-    cardSprite.setTexture(cardTexture);
+    // Base card texture comes from the template; the overlay texture is created on first flush
+    cardSprite.setTexture(cardTemplate->getCardTexture());
     cardSprite.setScale(scale, scale);
-
-    // Load overlay image/texture for scratch zones and setup sprite
-    overlayImage.loadFromFile(overlayPath);
-    overlayTexture.loadFromImage(overlayImage);
-    overlayTexture.setSmooth(false);
-    overlaySprite.setTexture(overlayTexture);
     overlaySprite.setScale(scale, scale);
 
-    // Initialize scratch mask to opaque overlay initially (no scratched pixels)
-    scratchMask = overlayImage;
+    setBrush(BRUSH_PRESETS[0].shape, BRUSH_PRESETS[0].baseRadius);
 
     // Load prize symbols from resource manager
-    lucky7Sprite.setTexture(ResourceManager::getTexture("7"));
-    emptySprite.setTexture(ResourceManager::getTexture("empty"));
-
-    // Detect scratch zones and assign prizes randomly
-    initializeZonesFromOverlay();
-    assignRandomPrizes();
-}
-
-// Helper: Check if pixel at (x,y) in image is opaque (alpha > 0)
-static bool isOpaque(const sf::Image& img, unsigned int x, unsigned int y) {
-    return img.getPixel(x, y).a > 0;
+    static const TextureId lucky7Symbol = ResourceManager::textureId("7");
+    static const TextureId emptySymbol = ResourceManager::textureId("empty");
+    ResourceManager::setSpriteTexture(lucky7Sprite, lucky7Symbol);
+    ResourceManager::setSpriteTexture(emptySprite, emptySymbol);
 }
 
 // Set card and overlay sprites position on screen
@@ -62,113 +53,193 @@ void ScratchCard::setPosition(float x, float y) {
 
 // Return width of card in pixels accounting for scale
 float ScratchCard::getWidth() const {
-    return cardTexture.getSize().x * scale;
+    return cardTemplate->getCardTexture().getSize().x * scale;
 }
 
 // Return height of card in pixels accounting for scale
 float ScratchCard::getHeight() const {
-    return cardTexture.getSize().y * scale;
+    return cardTemplate->getCardTexture().getSize().y * scale;
 }
 
 // Attempt to scratch the card at world coordinates (x, y).
 // Returns true if any pixels were scratched, false otherwise.
 bool ScratchCard::scratchAt(float x, float y, Player& player) {
-    // Convert world coordinates to local scratch mask coords
-    int localX = static_cast<int>((x - overlaySprite.getPosition().x) / scale);
-    int localY = static_cast<int>((y - overlaySprite.getPosition().y) / scale);
+    PROFILE_ZONE("ScratchCard::scratchAt");
+    sf::Vector2i local = toLocal(x, y);
+
+    // A zero-length sweep is a single brush stamp
+    if (!sweepBrush(local.x, local.y, local.x, local.y, false)) return false; // Nothing scratched, early out
+
+    finishScratch(player);
+    return true;
+}
+
+// Start a stroke at world coordinates (x, y) with a single brush stamp
+bool ScratchCard::beginStroke(float x, float y, Player& player) {
+    PROFILE_ZONE("ScratchCard::beginStroke");
+    sf::Vector2i local = toLocal(x, y);
+    strokeActive = true;
+    strokeX = local.x;
+    strokeY = local.y;
+
+    if (!sweepBrush(local.x, local.y, local.x, local.y, false)) return false;
+
+    finishScratch(player);
+    return true;
+}
+
+// Extend the active stroke to world coordinates (x, y), clearing everything the brush swept over
+bool ScratchCard::extendStroke(float x, float y, Player& player) {
+    PROFILE_ZONE("ScratchCard::extendStroke");
+    if (!strokeActive) return beginStroke(x, y, player);
+
+    sf::Vector2i local = toLocal(x, y);
+    if (local.x == strokeX && local.y == strokeY) return false; // Brush has not moved
+
+    // The brush at the previous sample was cleared by the last call, so skip it
+    bool scratchedAny = sweepBrush(strokeX, strokeY, local.x, local.y, true);
+    strokeX = local.x;
+    strokeY = local.y;
+
+    if (!scratchedAny) return false;
+
+    finishScratch(player);
+    return true;
+}
+
+// End the active stroke; the next extendStroke starts a new one
+void ScratchCard::endStroke() {
+    strokeActive = false;
+}
+
+// Convert world coordinates to local scratch mask coords
+sf::Vector2i ScratchCard::toLocal(float x, float y) const {
+    return sf::Vector2i(
+        static_cast<int>((x - overlaySprite.getPosition().x) / scale),
+        static_cast<int>((y - overlaySprite.getPosition().y) / scale));
+}
+
+// Select the brush shape and size; brush rows come from the precomputed span tables
+void ScratchCard::setBrush(BrushShape shape, int baseRadius) {
+    if (brush.getShape() == shape && brushBaseRadius == baseRadius && brush.getRadius() > 0) return;
 
     // Scratch radius decreases with scale but never less than 1 pixel
-    const int baseRadius = 8;
-    int radius = std::max(1, static_cast<int>(baseRadius / scale));
+    brush = Brush(shape, std::max(1, static_cast<int>(baseRadius / scale)));
+    brushBaseRadius = baseRadius;
 
-    bool scratchedAny = false;
+    // The skip-the-start optimisation in extendStroke assumes the previous footprint matches
+    strokeActive = false;
+}
 
-    // Loop over pixels in circle radius and clear alpha in scratch mask
-    for (int dx = -radius; dx <= radius; ++dx) {
-        for (int dy = -radius; dy <= radius; ++dy) {
-            int px = localX + dx;
-            int py = localY + dy;
-
-            // Check bounds and circular radius
-            if (px >= 0 && py >= 0 &&
-                px < static_cast<int>(scratchMask.getSize().x) &&
-                py < static_cast<int>(scratchMask.getSize().y) &&
-                dx * dx + dy * dy <= radius * radius) {
-
-                // Only scratch pixels that are not already transparent
-                if (scratchMask.getPixel(px, py).a != 0) {
-                    scratchMask.setPixel(px, py, sf::Color(0, 0, 0, 0)); // Clear pixel alpha
-                    scratchedAny = true;
-                }
-            }
+// Clip a span to the overlay once, then clear it in the mask and, if anything was newly cleared, in the overlay pixels
+bool ScratchCard::scratchSpan(int y, int x0, int x1) {
+    if (y < 0 || y >= static_cast<int>(model.getHeight())) return false;
+
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, static_cast<int>(model.getWidth()));
+    if (x0 >= x1 || model.clearClippedSpan(y, x0, x1) == 0) return false;
+
+    clearOverlaySpan(y, x0, x1);
+    return true;
+}
+
+// Clear the area swept by the brush moving from (x0, y0) to (x1, y1).
+// The brush rows are first merged into one [lo, hi) extent per mask row, then each row is cleared once.
+bool ScratchCard::sweepBrush(int x0, int y0, int x1, int y1, bool skipStart) {
+    const int r = brush.getRadius();
+    const int top = std::min(y0, y1) - r;
+    const int rows = std::abs(y1 - y0) + 2 * r + 1;
+
+    sweepLo.assign(rows, std::numeric_limits<int>::max());
+    sweepHi.assign(rows, std::numeric_limits<int>::min());
+
+    const int dx = x1 - x0;
+    const int dy = y1 - y0;
+    const int stepY = (dy >= 0) ? 1 : -1;
+
+    // Walk every row the brush center passes through
+    for (int cy = y0; ; cy += stepY) {
+        // Horizontal extent of the center while it is on row cy
+        int centerLo = std::min(x0, x1);
+        int centerHi = std::max(x0, x1);
+        if (dy != 0) {
+            float tA = std::clamp((cy - 0.5f - y0) / dy, 0.f, 1.f);
+            float tB = std::clamp((cy + 0.5f - y0) / dy, 0.f, 1.f);
+            float xA = x0 + tA * dx;
+            float xB = x0 + tB * dx;
+            centerLo = static_cast<int>(std::floor(std::min(xA, xB) + 0.5f));
+            centerHi = static_cast<int>(std::floor(std::max(xA, xB) + 0.5f));
         }
-    }
 
-    if (!scratchedAny) return false; // Nothing scratched, early out
+        // Every brush row, slid across that extent, covers one contiguous span
+        for (int by = -r; by <= r; ++by) {
+            const BrushSpan& span = brush.row(by);
+            if (span.start >= span.end) continue;
+
+            int row = cy + by - top;
+            sweepLo[row] = std::min(sweepLo[row], centerLo + span.start);
+            sweepHi[row] = std::max(sweepHi[row], centerHi + span.end);
+        }
 
-    // Update overlay texture with new scratch mask
-    updateOverlayTexture();
+        if (cy == y1) break;
+    }
 
-    // Update all zones progress and reveal any fully scratched zones
-    for (auto& zone : zones) {
-        if (!zone.revealed) {
-            updateZoneClearedPixels(zone);
+    // Rows outside the overlay are dropped here; columns are clipped per span in scratchSpan
+    const int firstRow = std::max(0, -top);
+    const int lastRow = std::min(rows, static_cast<int>(model.getHeight()) - top);
 
-            float percent = (zone.clearedPixels / static_cast<float>(zone.totalPixels)) * 100.f;
-            if (percent >= 97.f) { // Threshold to reveal zone
-                revealZone(zone, player);
+    bool scratchedAny = false;
+    for (int row = firstRow; row < lastRow; ++row) {
+        const int lo = sweepLo[row];
+        const int hi = sweepHi[row];
+        if (lo >= hi) continue;
+
+        const int y = top + row;
+        const int startRow = y - y0;
+
+        if (skipStart && startRow >= -r && startRow <= r) {
+            // Only clear what lies outside the brush footprint at the start point
+            const BrushSpan& prev = brush.row(startRow);
+            const int prevLo = x0 + prev.start;
+            const int prevHi = x0 + prev.end;
+
+            if (prevLo < prevHi && prevLo < hi && prevHi > lo) {
+                scratchedAny |= scratchSpan(y, lo, prevLo);
+                scratchedAny |= scratchSpan(y, prevHi, hi);
+                continue;
             }
         }
-    }
 
-    // Check if entire card is fully revealed now
-    if (!fullyRevealed && isFullyScratched()) {
-        fullyRevealed = true;
-        std::cout << "ScratchCard is fully revealed now!\n";
+        scratchedAny |= scratchSpan(y, lo, hi);
     }
 
-    return true;
+    return scratchedAny;
 }
 
-// Reveal a given zone fully (clear all pixels in zone) and apply its prize to player if not yet done
-void ScratchCard::revealZone(Zone& zone, Player& player) {
-    // Clear entire zone pixels in scratch mask
-    for (int px = zone.rect.left; px < zone.rect.left + zone.rect.width; ++px) {
-        for (int py = zone.rect.top; py < zone.rect.top + zone.rect.height; ++py) {
-            scratchMask.setPixel(px, py, sf::Color(0, 0, 0, 0));
-        }
+// Reveal touched zones that crossed the threshold and check whether the whole card is done
+void ScratchCard::finishScratch(Player& player) {
+    model.takeZonesReadyToReveal(revealReady);
+    for (int index : revealReady) {
+        revealZone(index, player);
     }
 
-    zone.revealed = true;
-    updateOverlayTexture();
-
-    if (zone.applied) return; // Already applied prize for this zone
-
-    // Apply prize effects based on prize type
-    switch (zone.prize.type) {
-    case PrizeType::Money:
-        lucky7Count++; // Count money prize as lucky7 for matching logic
-        std::cout << "[Debug] Lucky 7 revealed! Total so far: " << lucky7Count << "\n";
-        break;
-    case PrizeType::Multiplier:
-        accumulatedMultiplier += zone.prize.multiplier;
-        std::cout << "[Debug] Added Multiplier: " << zone.prize.multiplier
-            << ", Total Multiplier: " << accumulatedMultiplier << "\n";
-        break;
-    case PrizeType::Relic:
-        player.addRelic(zone.prize.relicId);
-        std::cout << "[Debug] Added Relic: " << zone.prize.relicId << "\n";
-        break;
-    default:
-        break;
-    }
+    // Check if entire card is fully revealed now
+    model.updateFullyRevealed();
+}
+
+// Reveal a zone in the model (mask and prize) and clear its rect in the overlay pixels
+void ScratchCard::revealZone(size_t zoneIndex, Player& player) {
+    model.revealZone(zoneIndex, player);
 
-    zone.applied = true;
+    const ZoneDetector::Zone& bounds = model.getZoneBounds(zoneIndex);
+    for (int py = bounds.top; py < bounds.top + bounds.height; ++py) {
+        clearOverlaySpan(py, bounds.left, bounds.left + bounds.width);
+    }
 }
 
 // Draw the base card sprite (big card image behind overlay)
-void ScratchCard::drawBase(sf::RenderTarget& target) const {
-    target.draw(baseSprite);
+void ScratchCard::drawBase(SpriteBatch& batch) const {
+    batch.draw(baseSprite, SpriteLayer::Base);
 }
 
 // Draw the overlay sprite (scratch mask on top)
@@ -177,34 +248,35 @@ void ScratchCard::drawOverlay(sf::RenderTarget& target) const {
 }
 
 // Draw prize symbols (e.g. lucky 7s) on their zones
-void ScratchCard::drawPrizes(sf::RenderTarget& target) const {
-    for (const auto& zone : zones) {
-        float posX = overlaySprite.getPosition().x + zone.rect.left * scale;
-        float posY = overlaySprite.getPosition().y + zone.rect.top * scale;
-        float width = zone.rect.width * scale;
-        float height = zone.rect.height * scale;
-
-        sf::Sprite sprite;
-
-        // Select sprite by prize type
-        switch (zone.prize.type) {
-        case PrizeType::Money: sprite = lucky7Sprite; break;
-        case PrizeType::None:  sprite = emptySprite;  break;
+void ScratchCard::drawPrizes(SpriteBatch& batch) const {
+    for (size_t i = 0; i < model.getZoneCount(); ++i) {
+        const ZoneDetector::Zone& bounds = model.getZoneBounds(i);
+        float posX = overlaySprite.getPosition().x + bounds.left * scale;
+        float posY = overlaySprite.getPosition().y + bounds.top * scale;
+        float width = bounds.width * scale;
+        float height = bounds.height * scale;
+
+        // Select symbol by prize type
+        const sf::Sprite* symbol = nullptr;
+        switch (model.getZonePrize(i).type) {
+        case PrizeType::Money: symbol = &lucky7Sprite; break;
+        case PrizeType::None:  symbol = &emptySprite;  break;
         default: continue; // Skip Multiplier & Relic visuals here
         }
+        if (!symbol->getTexture()) continue;
 
-        // Scale sprite to fit within 80% of zone rect
-        float scaleX = (width * 0.8f) / sprite.getTexture()->getSize().x;
-        float scaleY = (height * 0.8f) / sprite.getTexture()->getSize().y;
+        // Scale symbol to fit within 80% of zone rect (symbols may sit on an atlas page)
+        const sf::IntRect& symbolRect = symbol->getTextureRect();
+        float scaleX = (width * 0.8f) / symbolRect.width;
+        float scaleY = (height * 0.8f) / symbolRect.height;
         float finalScale = std::min(scaleX, scaleY);
-        sprite.setScale(finalScale, finalScale);
 
-        // Center sprite within zone
-        float spriteW = sprite.getTexture()->getSize().x * finalScale;
-        float spriteH = sprite.getTexture()->getSize().y * finalScale;
-        sprite.setPosition(posX + (width - spriteW) / 2.f, posY + (height - spriteH) / 2.f);
+        // Center symbol within zone
+        float spriteW = symbolRect.width * finalScale;
+        float spriteH = symbolRect.height * finalScale;
+        sf::FloatRect dest(posX + (width - spriteW) / 2.f, posY + (height - spriteH) / 2.f, spriteW, spriteH);
 
-        target.draw(sprite);
+        batch.draw(*symbol->getTexture(), symbolRect, dest, SpriteLayer::Symbols);
     }
 }
 
@@ -212,11 +284,13 @@ void ScratchCard::drawPrizes(sf::RenderTarget& target) const {
 std::vector<PrizeTextInfo> ScratchCard::getRevealedPrizeTexts() const {
     std::vector<PrizeTextInfo> result;
 
-    for (const auto& zone : zones) {
-        if (zone.prize.type == PrizeType::Multiplier) {
-            std::string txt = getPrizeText(zone.prize);
-            float x = overlaySprite.getPosition().x + (zone.rect.left + zone.rect.width / 2.f) * scale;
-            float y = overlaySprite.getPosition().y + (zone.rect.top + zone.rect.height / 2.f) * scale;
+    for (size_t i = 0; i < model.getZoneCount(); ++i) {
+        const Prize& prize = model.getZonePrize(i);
+        if (prize.type == PrizeType::Multiplier) {
+            const ZoneDetector::Zone& bounds = model.getZoneBounds(i);
+            std::string txt = getPrizeText(prize);
+            float x = overlaySprite.getPosition().x + (bounds.left + bounds.width / 2.f) * scale;
+            float y = overlaySprite.getPosition().y + (bounds.top + bounds.height / 2.f) * scale;
             result.push_back({ txt, sf::Vector2f(x, y) });
         }
     }
@@ -224,206 +298,128 @@ std::vector<PrizeTextInfo> ScratchCard::getRevealedPrizeTexts() const {
     return result;
 }
 
-// Apply accumulated winnings to player balance and reset counters
-void ScratchCard::applyWinningsToPlayer(Player& player) {
-    if (winningsApplied) return; // Avoid double applying
-
-    // Determine base reward based on number of lucky 7 matches
-    int baseReward = 0;
-    switch (lucky7Count) {
-    case 2: baseReward = 10; break;
-    case 3: baseReward = 20; break;
-    case 4: baseReward = 50; break;
-    case 5: baseReward = 100; break;
-    default: break;
-    }
-
-    // Calculate final reward with multiplier
-    int finalReward = static_cast<int>(baseReward * accumulatedMultiplier);
-    accumulatedMoney = finalReward; // Store reward
-
-    if (finalReward > 0) {
-        player.addBalance(finalReward);
-        std::cout << "[Debug] Lucky 7s matched: " << lucky7Count
-            << " ? Base: " << baseReward
-            << ", x" << accumulatedMultiplier
-            << " = " << finalReward << "\n";
-    }
-    else {
-        std::cout << "[Debug] Not enough Lucky 7s to win a reward (count = " << lucky7Count << ").\n";
+// Draw cached multiplier labels, rebuilding them only when the font, size or prizes changed
+void ScratchCard::drawPrizeLabels(sf::RenderTarget& target, const sf::Font& font, unsigned int characterSize) {
+    if (prizeLabelsDirty || prizeLabelFont != &font || prizeLabelSize != characterSize) {
+        prizeLabelFont = &font;
+        prizeLabelSize = characterSize;
+        prizeLabelsDirty = false;
+        prizeLabels.clear();
+
+        const sf::Vector2f origin = overlaySprite.getPosition();
+        for (const auto& info : getRevealedPrizeTexts()) {
+            sf::Text text(info.text, font, characterSize);
+            text.setFillColor(sf::Color::Black);
+
+            sf::FloatRect bounds = text.getLocalBounds();
+            text.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
+            text.setPosition(info.position - origin);
+            prizeLabels.push_back(std::move(text));
+        }
     }
 
-    winningsApplied = true;
-
-    // Reset multiplier and lucky7 counter for next card
-    accumulatedMultiplier = 1.f;
-    lucky7Count = 0;
-}
-
-// Randomly assign prizes to each detected zone on the card
-void ScratchCard::assignRandomPrizes() {
-    std::cout << "Assigning prizes to card at " << this << "\n";
-
-    for (auto& zone : zones) {
-        int r = Utils::randInt(0, 99);
-        std::cout << "  Prize roll: " << r;
-
-        if (r < 50) {
-            std::cout << " ? Money\n";
-            zone.prize = { PrizeType::Money };
-        }
-        else if (r < 90) {
-            std::cout << " ? None\n";
-            zone.prize = { PrizeType::None };
-        }
-        else {
-            // Random multiplier between 1.5 and 2.5 approx.
-            float mult = 1.5f + Utils::randFloat(0.f, 1.f);
-            std::cout << " ? Multiplier: " << mult << "\n";
-            zone.prize = { PrizeType::Multiplier, 0, mult };
-        }
+    sf::RenderStates states;
+    states.transform.translate(overlaySprite.getPosition());
+    for (const auto& label : prizeLabels) {
+        target.draw(label, states);
     }
 }
 
 // Instantly reveal all zones and clear scratch mask
 void ScratchCard::revealAll() {
-    for (unsigned int x = 0; x < scratchMask.getSize().x; ++x) {
-        for (unsigned int y = 0; y < scratchMask.getSize().y; ++y) {
-            scratchMask.setPixel(x, y, sf::Color(0, 0, 0, 0)); // Clear all pixels
-        }
-    }
-
-    for (auto& zone : zones) {
-        zone.revealed = true;
+    model.revealAll();
+    for (size_t i = 3; i < overlayPixels.size(); i += 4) {
+        overlayPixels[i] = 0; // Clear all pixel alpha (no-op until the overlay is created)
     }
 
-    updateOverlayTexture();
-    fullyRevealed = true;
-}
-
-// Returns true if card is fully revealed
-bool ScratchCard::isFullyRevealed() const {
-    return fullyRevealed;
+    markOverlayDirty(0, 0, model.getWidth(), model.getHeight());
 }
 
-// Calculate overall scratch completion percent (0-100)
-float ScratchCard::getScratchCompletionPercent() const {
-    int totalPixels = scratchMask.getSize().x * scratchMask.getSize().y;
-    int cleared = 0;
-
-    for (unsigned int x = 0; x < scratchMask.getSize().x; ++x) {
-        for (unsigned int y = 0; y < scratchMask.getSize().y; ++y) {
-            if (scratchMask.getPixel(x, y).a == 0) ++cleared;
+// Upload the dirty rectangle of the overlay pixels, if any, in a single texture update
+size_t ScratchCard::flushOverlayTexture() {
+    PROFILE_ZONE("ScratchCard::flushOverlayTexture");
+    overlayBytesLastFlush = 0;
+    if (overlayPixels.empty()) createOverlay();
+    if (dirtyRight <= dirtyLeft || dirtyBottom <= dirtyTop) return 0;
+
+    const unsigned int width = model.getWidth();
+    const unsigned int rectWidth = dirtyRight - dirtyLeft;
+    const unsigned int rectHeight = dirtyBottom - dirtyTop;
+    const size_t rowBytes = static_cast<size_t>(rectWidth) * 4;
+
+    if (rectWidth == width) {
+        // Full-width rows are already contiguous in the overlay buffer
+        overlayTexture.update(&overlayPixels[static_cast<size_t>(dirtyTop) * width * 4],
+            rectWidth, rectHeight, 0, dirtyTop);
+    }
+    else {
+        // Pack the sub-rect rows tightly for the upload
+        uploadStaging.resize(rowBytes * rectHeight);
+        for (unsigned int row = 0; row < rectHeight; ++row) {
+            const sf::Uint8* src = &overlayPixels[((static_cast<size_t>(dirtyTop) + row) * width + dirtyLeft) * 4];
+            std::copy(src, src + rowBytes, &uploadStaging[row * rowBytes]);
         }
+        overlayTexture.update(uploadStaging.data(), rectWidth, rectHeight, dirtyLeft, dirtyTop);
     }
 
-    return (cleared / static_cast<float>(totalPixels)) * 100.f;
-}
-
-// Returns true if all zones are fully revealed
-bool ScratchCard::isFullyScratched() const {
-    for (const auto& zone : zones) {
-        if (!zone.revealed) return false;
-    }
-    return true;
-}
+    overlayBytesLastFlush = rowBytes * rectHeight;
+    overlayBytesTotal += overlayBytesLastFlush;
 
-// Initialize zones vector by detecting opaque regions in overlay image
-void ScratchCard::initializeZonesFromOverlay() {
-    zones.clear();
-    detectZones();
+    dirtyLeft = dirtyTop = dirtyRight = dirtyBottom = 0;
+    return overlayBytesLastFlush;
 }
 
-// Detect connected opaque regions as scratch zones using flood fill
-void ScratchCard::detectZones() {
-    unsigned int width = overlayImage.getSize().x;
-    unsigned int height = overlayImage.getSize().y;
-
-    // 2D visited array for flood fill
-    std::vector<std::vector<bool>> visited(width, std::vector<bool>(height, false));
-
-    for (unsigned int x = 0; x < width; ++x) {
-        for (unsigned int y = 0; y < height; ++y) {
-            if (!visited[x][y] && isOpaque(overlayImage, x, y)) {
-                sf::IntRect zoneRect = floodFill(x, y, visited);
-
-                Zone zone;
-                zone.rect = zoneRect;
-                zone.revealed = false;
-                zone.applied = false;
-
-                // Count opaque pixels inside zone rect
-                int count = 0;
-                for (int px = zoneRect.left; px < zoneRect.left + zoneRect.width; ++px) {
-                    for (int py = zoneRect.top; py < zoneRect.top + zoneRect.height; ++py) {
-                        if (isOpaque(overlayImage, px, py)) count++;
-                    }
-                }
+// Build the overlay pixels from the template image with every cleared mask pixel made transparent,
+// then create the overlay texture and mark it dirty so the next upload fills it
+void ScratchCard::createOverlay() {
+    const unsigned int width = model.getWidth();
+    const unsigned int height = model.getHeight();
+    if (width == 0 || height == 0) return;
 
-                zone.totalPixels = count;
-                zone.clearedPixels = 0;
+    const sf::Uint8* pixels = cardTemplate->getOverlayImage().getPixelsPtr();
+    overlayPixels.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
 
-                zones.push_back(zone);
-            }
+    for (unsigned int y = 0; y < height; ++y) {
+        sf::Uint8* alpha = &overlayPixels[static_cast<size_t>(y) * width * 4 + 3];
+        for (unsigned int x = 0; x < width; ++x, alpha += 4) {
+            if (model.isCleared(x, y)) *alpha = 0;
         }
     }
+
+    overlayTexture.create(width, height);
+    overlayTexture.setSmooth(false);
+    overlaySprite.setTexture(overlayTexture, true);
+
+    markOverlayDirty(0, 0, width, height);
 }
 
-// Flood fill algorithm to find connected opaque region starting at (startX, startY)
-sf::IntRect ScratchCard::floodFill(unsigned int startX, unsigned int startY, std::vector<std::vector<bool>>& visited) {
-    unsigned int width = overlayImage.getSize().x;
-    unsigned int height = overlayImage.getSize().y;
-
-    unsigned int minX = startX, maxX = startX, minY = startY, maxY = startY;
-    std::queue<std::pair<unsigned int, unsigned int>> q;
-    q.push({ startX, startY });
-    visited[startX][startY] = true;
-
-    // Directions for neighbors (left, right, up, down)
-    const int dx[] = { 1, -1, 0, 0 };
-    const int dy[] = { 0, 0, 1, -1 };
-
-    while (!q.empty()) {
-        auto [x, y] = q.front();
-        q.pop();
-
-        for (int dir = 0; dir < 4; ++dir) {
-            int nx = x + dx[dir];
-            int ny = y + dy[dir];
-
-            // Check bounds and visit opaque pixels not yet visited
-            if (nx >= 0 && ny >= 0 && nx < static_cast<int>(width) && ny < static_cast<int>(height)) {
-                if (!visited[nx][ny] && isOpaque(overlayImage, nx, ny)) {
-                    visited[nx][ny] = true;
-                    q.push({ (unsigned)nx, (unsigned)ny });
-
-                    // Update bounding box
-                    minX = std::min(minX, static_cast<unsigned>(nx));
-                    maxX = std::max(maxX, static_cast<unsigned>(nx));
-                    minY = std::min(minY, static_cast<unsigned>(ny));
-                    maxY = std::max(maxY, static_cast<unsigned>(ny));
-                }
-            }
-        }
+// Grow the dirty rectangle to include [x0, x1) x [y0, y1)
+void ScratchCard::markOverlayDirty(int x0, int y0, int x1, int y1) {
+    if (dirtyRight <= dirtyLeft || dirtyBottom <= dirtyTop) {
+        dirtyLeft = x0;
+        dirtyTop = y0;
+        dirtyRight = x1;
+        dirtyBottom = y1;
+        return;
     }
 
-    return sf::IntRect(minX, minY, maxX - minX + 1, maxY - minY + 1);
+    dirtyLeft = std::min(dirtyLeft, x0);
+    dirtyTop = std::min(dirtyTop, y0);
+    dirtyRight = std::max(dirtyRight, x1);
+    dirtyBottom = std::max(dirtyBottom, y1);
 }
 
-// Count how many pixels in zone are cleared (alpha == 0)
-void ScratchCard::updateZoneClearedPixels(Zone& zone) {
-    int cleared = 0;
-    for (int px = zone.rect.left; px < zone.rect.left + zone.rect.width; ++px) {
-        for (int py = zone.rect.top; py < zone.rect.top + zone.rect.height; ++py) {
-            if (scratchMask.getPixel(px, py).a == 0) ++cleared;
-        }
+// Zero the overlay alpha for pixels [x0, x1) on row y so they show as scratched
+void ScratchCard::clearOverlaySpan(int y, int x0, int x1) {
+    if (overlayPixels.empty()) return; // Not created yet; createOverlay reads the mask
+
+    const size_t width = model.getWidth();
+    sf::Uint8* alpha = &overlayPixels[(static_cast<size_t>(y) * width + x0) * 4 + 3];
+    for (int x = x0; x < x1; ++x, alpha += 4) {
+        *alpha = 0;
     }
-    zone.clearedPixels = cleared;
-}
 
-// Update overlay texture from scratchMask image after scratching
-void ScratchCard::updateOverlayTexture() {
-    overlayTexture.update(scratchMask);
+    markOverlayDirty(x0, y, x1, y + 1);
 }
 
 // Return string representation of prize to render as text
@@ -459,20 +455,13 @@ void ScratchCard::loadCard(const std::string& cardId) {
 
 // Reset scratch progress and all prizes
 void ScratchCard::resetScratch() {
-    scratchMask = overlayImage;    // Reset scratch mask to opaque
-    updateOverlayTexture();
-
-    for (auto& zone : zones) {
-        zone.revealed = false;
-        zone.applied = false;
-        zone.clearedPixels = 0;
+    model.reset();                 // Reset scratch mask, zones and winnings to unscratched state
+    prizeLabelsDirty = true;
+    if (!overlayPixels.empty()) {
+        const sf::Uint8* pixels = cardTemplate->getOverlayImage().getPixelsPtr();
+        std::copy(pixels, pixels + overlayPixels.size(), overlayPixels.begin());
+        markOverlayDirty(0, 0, model.getWidth(), model.getHeight());
     }
-
-    fullyRevealed = false;
-    winningsApplied = false;
-    accumulatedMoney = 0;
-    accumulatedMultiplier = 1.f;
-    lucky7Count = 0;
 }
 
 // Start auto scratch sequence (auto reveal zones with timer)
@@ -492,10 +481,9 @@ void ScratchCard::updateAutoScratch(float dt, Player& player) {
     if (autoScratchTimer >= autoScratchInterval) {
         autoScratchTimer = 0.f;
 
-        if (autoScratchZoneIndex < zones.size()) {
-            Zone& zone = zones[autoScratchZoneIndex];
-            if (!zone.revealed) {
-                revealZone(zone, player);
+        if (autoScratchZoneIndex < model.getZoneCount()) {
+            if (!model.isZoneRevealed(autoScratchZoneIndex)) {
+                revealZone(autoScratchZoneIndex, player);
             }
             autoScratchZoneIndex++;
 
@@ -505,8 +493,8 @@ void ScratchCard::updateAutoScratch(float dt, Player& player) {
         else {
             // All zones auto scratched
             autoScratchActive = false;
-            fullyRevealed = true;  // Mark card fully revealed
-            std::cout << "Auto scratch complete for current card.\n";
+            model.markFullyRevealed();  // Mark card fully revealed
+            LOG_DEBUG(Cards, "Auto scratch complete for current card");
         }
     }
 }
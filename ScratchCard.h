@@ -2,9 +2,14 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 #include "Prize.h"
+#include "Brush.h"
+#include "CardTemplate.h"
+#include "ScratchCardModel.h"
+#include "SpriteBatch.h"
 
 // Forward declaration to avoid circular dependency
 class Player;
@@ -15,18 +20,45 @@ struct PrizeTextInfo {
     sf::Vector2f position;
 };
 
+// On-screen view of a ScratchCardModel: turns mouse input into scratched spans,
+// keeps the overlay texture in sync with the mask and draws prizes.
+// Game rules and payouts live in the model.
 class ScratchCard {
 public:
-    // Constructor: loads card and overlay textures, sets scale
+    // Constructor: takes the shared card template for these images (loaded once per pair), sets scale.
+    // Zones start without prizes; call assignRandomPrizes.
     ScratchCard(const std::string& cardPath, const std::string& overlayPath, float scale);
 
+    // Build on a template that is already loaded (e.g. CardTemplate::fromOverlay)
+    ScratchCard(std::shared_ptr<const CardTemplate> sharedTemplate, float scale);
+
     // Attempt to scratch at given coordinates, returns true if scratch occurred
     bool scratchAt(float x, float y, Player& player);
 
+    // Continuous strokes: begin stamps the brush once, each extend clears the area swept by the
+    // brush between the previous sample and the new one. Both return true if scratch occurred.
+    bool beginStroke(float x, float y, Player& player);
+    bool extendStroke(float x, float y, Player& player);
+    void endStroke();
+    bool isStrokeActive() const { return strokeActive; }
+
+    // Select the scratch tool; radius is in screen pixels and is divided by the card scale.
+    // Changing the brush ends the active stroke.
+    void setBrush(BrushShape shape, int baseRadius);
+
     // Drawing functions to separate base card and scratch overlay
-    void drawBase(sf::RenderTarget& target) const;
+    void drawBase(SpriteBatch& batch) const;
     void drawOverlay(sf::RenderTarget& target) const;
 
+    // Upload the dirty part of the overlay to the GPU; call once per rendered frame before drawOverlay.
+    // The overlay pixels and texture are created on the first call, so cards never shown cost no GPU memory.
+    // Returns the number of bytes uploaded.
+    size_t flushOverlayTexture();
+
+    // Bytes uploaded by the most recent flushOverlayTexture call, and over the card's lifetime
+    size_t getOverlayBytesUploadedLastFlush() const { return overlayBytesLastFlush; }
+    size_t getOverlayBytesUploadedTotal() const { return overlayBytesTotal; }
+
     // Set card position on screen
     void setPosition(float x, float y);
 
@@ -34,44 +66,55 @@ public:
     float getWidth() const;
     float getHeight() const;
 
+    // Game state of this card (zones, prizes, scratch progress, winnings)
+    const ScratchCardModel& getModel() const { return model; }
+
     // Get prize text info for revealed multiplier zones for rendering
     std::vector<PrizeTextInfo> getRevealedPrizeTexts() const;
 
+    // Draw the multiplier labels centred on their zones. The texts are built on the first call
+    // (or when the font or prizes change) relative to the card and only translated afterwards.
+    void drawPrizeLabels(sf::RenderTarget& target, const sf::Font& font, unsigned int characterSize);
+
     // Percentage of the card scratched off (0 to 100)
-    float getScratchCompletionPercent() const;
+    float getScratchCompletionPercent() const { return model.getScratchCompletionPercent(); }
 
     // Reveal all zones instantly
     void revealAll();
 
     // Check if card is fully revealed
-    bool isFullyRevealed() const;
+    bool isFullyRevealed() const { return model.isFullyRevealed(); }
 
-    // Prepare zones from overlay image (called on load/reset)
-    void initializeZonesFromOverlay();
+    // Prepare per-card zone state from the template's zones (called on load/reset)
+    void initializeZonesFromOverlay() { model.initializeZones(); }
 
-    // Randomly assign prizes to each zone
-    void assignRandomPrizes();
+    // Randomly assign prizes to each zone, from the card's own stream (see Random::card) or the shared prize stream
+    void assignRandomPrizes(RandomStream rng) { model.assignRandomPrizes(rng); prizeLabelsDirty = true; }
+    void assignRandomPrizes() { model.assignRandomPrizes(Random::prizes()); prizeLabelsDirty = true; }
 
     // Check if all zones are fully revealed
-    bool isFullyScratched() const;
+    bool isFullyScratched() const { return model.isFullyScratched(); }
 
     // Get total accumulated money prize
-    int getAccumulatedMoney() const { return accumulatedMoney; }
+    int getAccumulatedMoney() const { return model.getAccumulatedMoney(); }
 
     // Get accumulated multiplier prize
-    float getAccumulatedMultiplier() const { return accumulatedMultiplier; }
+    float getAccumulatedMultiplier() const { return model.getAccumulatedMultiplier(); }
 
     // Apply winnings (money/multiplier/relics) to player balance and stats
-    void applyWinningsToPlayer(Player& player);
+    void applyWinningsToPlayer(Player& player) { model.applyWinningsToPlayer(player); }
+
+    // Use different odds and payouts (e.g. a RelicPlan's rules, which must outlive the card)
+    void setRules(const PrizeRules& rules) { model.setRules(rules); prizeLabelsDirty = true; }
 
-    // Draw prize symbols on the card
-    void drawPrizes(sf::RenderTarget& target) const;
+    // Queue prize symbols on the card; symbols share an atlas page, so they batch into one draw
+    void drawPrizes(SpriteBatch& batch) const;
 
     // Get textual representation of a prize (e.g. "10", "x1.5")
     std::string getPrizeText(const Prize& prize) const;
 
     // Check if winnings have already been applied (to avoid duplicates)
-    bool areWinningsApplied() const { return winningsApplied; }
+    bool areWinningsApplied() const { return model.areWinningsApplied(); }
 
     // Load card textures by card ID (supports mapping shop preview IDs to big textures)
     void loadCard(const std::string& cardId);
@@ -95,59 +138,78 @@ public:
     void updateAutoScratch(float dt, Player& player);
 
 private:
-    sf::Texture cardTexture;       // Card base texture (small or large)
+    std::shared_ptr<const CardTemplate> cardTemplate;   // Shared card texture, overlay image and layout
+    ScratchCardModel model;                             // Game rules and scratch state
+
     sf::Sprite cardSprite;         // Card sprite for positioning and drawing
 
     sf::Sprite baseSprite;         // Base sprite that displays large card texture for scratching
 
-    sf::Image overlayImage;        // Overlay image used to define scratchable zones (alpha channel)
-    sf::Texture overlayTexture;    // Overlay texture updated with scratch mask
+    sf::Texture overlayTexture;    // Overlay texture updated with scratch mask (created on first flush)
     sf::Sprite overlaySprite;      // Overlay sprite drawn on top of baseSprite
 
-    sf::Image scratchMask;         // Image mask tracking scratched pixels (alpha 0 = scratched)
+    std::vector<sf::Uint8> overlayPixels;   // RGBA overlay pixels with scratched alpha zeroed, for uploads (empty until first flush)
+    std::vector<sf::Uint8> uploadStaging;   // Packed copy of a dirty sub-rect for partial texture updates
+
+    // Union of overlay regions changed since the last flush (half-open, empty when right <= left)
+    int dirtyLeft = 0;
+    int dirtyTop = 0;
+    int dirtyRight = 0;
+    int dirtyBottom = 0;
+
+    size_t overlayBytesLastFlush = 0;
+    size_t overlayBytesTotal = 0;
 
     float scale;                   // Scale applied to card and overlay sprites
-    bool fullyRevealed = false;    // Flag indicating card is fully revealed
 
-    // Update overlay texture from current scratch mask image
-    void updateOverlayTexture();
+    // Current brush footprint and the settings it was built from
+    Brush brush;
+    int brushBaseRadius = 0;
+
+    // Active stroke state, in overlay pixel coordinates
+    bool strokeActive = false;
+    int strokeX = 0;
+    int strokeY = 0;
 
-    // Represents a scratch zone on the card
-    struct Zone {
-        sf::IntRect rect;          // Rectangular bounds of the zone
-        int totalPixels = 0;       // Total opaque pixels in zone
-        int clearedPixels = 0;     // Currently scratched pixels in zone
-        bool revealed = false;     // Has zone been revealed (fully scratched)
-        bool applied = false;      // Have prizes in this zone been applied to player
-        Prize prize;               // Prize assigned to this zone
+    // Reused per-row extents of the swept area (relative to its top row)
+    std::vector<int> sweepLo;
+    std::vector<int> sweepHi;
 
-        sf::Sprite symbol;         // Optional sprite for prize symbol
-    };
+    std::vector<int> revealReady;  // Reused buffer of zones that crossed the reveal threshold
 
-    std::vector<Zone> zones;       // All scratch zones on the card
+    // Cached multiplier labels, positioned relative to the card's top-left corner
+    std::vector<sf::Text> prizeLabels;
+    const sf::Font* prizeLabelFont = nullptr;
+    unsigned int prizeLabelSize = 0;
+    bool prizeLabelsDirty = true;  // Prizes changed since the labels were built
 
-    // Detect scratch zones from overlay image alpha regions
-    void detectZones();
+    // Grow the dirty rectangle to include [x0, x1) x [y0, y1)
+    void markOverlayDirty(int x0, int y0, int x1, int y1);
 
-    // Flood fill to find connected opaque pixels for zone detection
-    sf::IntRect floodFill(unsigned int x, unsigned int y, std::vector<std::vector<bool>>& visited);
+    // Zero the overlay alpha for pixels [x0, x1) on row y; the span must lie inside the overlay
+    void clearOverlaySpan(int y, int x0, int x1);
 
-    // Update cleared pixel count for given zone
-    void updateZoneClearedPixels(Zone& zone);
+    // Build the overlay pixels from the template image and the mask, and create the overlay texture
+    void createOverlay();
 
-    // Reveal a zone fully and apply prize if not already done
-    void revealZone(Zone& zone, Player& player);
+    // Convert world coordinates to overlay pixel coordinates
+    sf::Vector2i toLocal(float x, float y) const;
 
-    // Accumulated winnings state
-    int accumulatedMoney = 0;
-    float accumulatedMultiplier = 1.f;
-    bool winningsApplied = false;
+    // Clip pixels [x0, x1) on row y to the overlay once, then clear them in mask and overlay;
+    // returns true if any were newly cleared
+    bool scratchSpan(int y, int x0, int x1);
+
+    // Clear the area swept by the brush moving from (x0, y0) to (x1, y1) in one pass over each row.
+    // With skipStart, pixels under the brush at the start point (already cleared) are not revisited.
+    bool sweepBrush(int x0, int y0, int x1, int y1, bool skipStart);
+
+    // Reveal touched zones past the threshold and update the fully revealed flag
+    void finishScratch(Player& player);
+
+    // Reveal a zone in the model and clear its rect in the overlay
+    void revealZone(size_t zoneIndex, Player& player);
 
     // Cached symbols for prizes
     sf::Sprite emptySprite;
     sf::Sprite lucky7Sprite;
-
-    // Counts of prize symbols found
-    int emptyCount = 0;
-    int lucky7Count = 0;
 };
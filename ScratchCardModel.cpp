@@ -0,0 +1,197 @@
+#include "ScratchCardModel.h"
+#include "Player.h"
+#include "Log.h"
+
+// Detect zones in RGBA overlay pixels and build the mask layout from them
+std::shared_ptr<const CardLayout> CardLayout::fromOverlay(const std::uint8_t* rgba, unsigned int width, unsigned int height) {
+    // Connected opaque regions of the overlay become scratch zones
+    ZoneDetector::Options options;
+    options.bands = ZoneDetector::suggestBandCount(width, height);
+
+    ZoneDetector::Result detected = ZoneDetector::detect(rgba, width, height, options);
+    return fromZones(rgba, width, height, std::move(detected.zones), std::move(detected.labels));
+}
+
+// Build from zones and a label map detected ahead of time
+std::shared_ptr<const CardLayout> CardLayout::fromZones(const std::uint8_t* rgba, unsigned int width, unsigned int height,
+    std::vector<ZoneDetector::Zone> zones, std::vector<std::uint32_t> labels) {
+    auto layout = std::make_shared<CardLayout>();
+    layout->zones = std::move(zones);
+
+    // Transparent pixels start out cleared; the label map attributes cleared pixels to zones
+    layout->mask = ScratchMask::buildLayout(rgba, width, height,
+        std::move(labels), static_cast<int>(layout->zones.size()));
+
+    return layout;
+}
+
+// Create an unscratched card with no prizes assigned
+ScratchCardModel::ScratchCardModel(std::shared_ptr<const CardLayout> cardLayout)
+    : layout(std::move(cardLayout)), mask(layout->mask)
+{
+    initializeZones();
+}
+
+// Reset per-zone state, one entry per layout zone
+void ScratchCardModel::initializeZones() {
+    zones.assign(layout->zones.size(), Zone());
+    revealedZoneCount = 0;
+}
+
+// Assign a prize to each zone, drawing rolls from rng
+void ScratchCardModel::assignRandomPrizes(RandomStream& rng) {
+    LOG_DEBUG(Prizes, "Assigning prizes", { { "zones", zones.size() } });
+
+    for (auto& zone : zones) {
+        int r = rng.range(0, 99);
+
+        PrizeType type = rules->rollType(r);
+        if (type == PrizeType::Money) {
+            LOG_TRACE(Prizes, "Prize roll", { { "roll", r }, { "prize", "Money" } });
+            zone.prize = { PrizeType::Money };
+        }
+        else if (type == PrizeType::None) {
+            LOG_TRACE(Prizes, "Prize roll", { { "roll", r }, { "prize", "None" } });
+            zone.prize = { PrizeType::None };
+        }
+        else {
+            // Random multiplier in [multiplierMin, multiplierMin + multiplierSpan)
+            float mult = rules->multiplierFor(rng.unit());
+            LOG_TRACE(Prizes, "Prize roll", { { "roll", r }, { "prize", "Multiplier" }, { "multiplier", mult } });
+            zone.prize = { PrizeType::Multiplier, 0, mult };
+        }
+    }
+}
+
+// Only zones that owned a pixel cleared since the last call can have crossed the reveal threshold
+void ScratchCardModel::takeZonesReadyToReveal(std::vector<int>& out) {
+    out.clear();
+    mask.takeTouchedZones(touchedZones);
+    for (int index : touchedZones) {
+        if (!zones[index].revealed && getZoneClearedPercent(index) >= 97.f) { // Threshold to reveal zone
+            out.push_back(index);
+        }
+    }
+}
+
+// Reveal a given zone fully (clear all pixels in zone) and apply its prize to player if not yet done
+void ScratchCardModel::revealZone(size_t zoneIndex, Player& player) {
+    const ZoneDetector::Zone& bounds = layout->zones[zoneIndex];
+    Zone& zone = zones[zoneIndex];
+
+    // Clear entire zone pixels in scratch mask
+    mask.clearRect(bounds.left, bounds.top, bounds.width, bounds.height);
+
+    if (!zone.revealed) {
+        zone.revealed = true;
+        ++revealedZoneCount;
+    }
+
+    if (zone.applied) return; // Already applied prize for this zone
+
+    // Apply prize effects based on prize type
+    switch (zone.prize.type) {
+    case PrizeType::Money:
+        lucky7Count++; // Count money prize as lucky7 for matching logic
+        LOG_DEBUG(Cards, "Lucky 7 revealed", { { "zone", zoneIndex }, { "total", lucky7Count } });
+        break;
+    case PrizeType::Multiplier:
+        accumulatedMultiplier += zone.prize.multiplier;
+        LOG_DEBUG(Cards, "Added multiplier", { { "zone", zoneIndex }, { "multiplier", zone.prize.multiplier },
+            { "total", accumulatedMultiplier } });
+        break;
+    case PrizeType::Relic:
+        player.addRelic(zone.prize.relicId);
+        LOG_DEBUG(Cards, "Added relic", { { "zone", zoneIndex }, { "relic", zone.prize.relicId } });
+        break;
+    default:
+        break;
+    }
+
+    zone.applied = true;
+}
+
+// Instantly reveal all zones and clear scratch mask
+void ScratchCardModel::revealAll() {
+    mask.clearAll();
+
+    for (auto& zone : zones) {
+        zone.revealed = true;
+    }
+    revealedZoneCount = zones.size();
+    fullyRevealed = true;
+}
+
+// Set the fully revealed flag once every zone is revealed
+bool ScratchCardModel::updateFullyRevealed() {
+    if (fullyRevealed || !isFullyScratched()) return false;
+
+    fullyRevealed = true;
+    LOG_DEBUG(Cards, "Card fully revealed");
+    return true;
+}
+
+// Calculate overall scratch completion percent (0-100)
+float ScratchCardModel::getScratchCompletionPercent() const {
+    int totalPixels = mask.getPixelCount();
+    if (totalPixels == 0) return 0.f;
+
+    return (mask.getClearedCount() / static_cast<float>(totalPixels)) * 100.f;
+}
+
+// Percentage of zone pixels cleared, read from the mask's running counter
+float ScratchCardModel::getZoneClearedPercent(size_t zoneIndex) const {
+    const int totalPixels = layout->zones[zoneIndex].pixelCount;
+    return (mask.getZoneClearedCount(static_cast<int>(zoneIndex)) / static_cast<float>(totalPixels)) * 100.f;
+}
+
+// Determine base reward based on number of lucky 7 matches
+int ScratchCardModel::getBaseReward() const {
+    return rules->baseReward(lucky7Count);
+}
+
+// Base reward scaled by the accumulated multiplier
+int ScratchCardModel::computeReward() const {
+    return rules->payout(lucky7Count, accumulatedMultiplier);
+}
+
+// Apply accumulated winnings to player balance and reset counters
+void ScratchCardModel::applyWinningsToPlayer(Player& player) {
+    if (winningsApplied) return; // Avoid double applying
+
+    // Calculate final reward with multiplier
+    int finalReward = computeReward();
+    accumulatedMoney = finalReward; // Store reward
+
+    if (finalReward > 0) {
+        player.addBalance(finalReward);
+        LOG_INFO(Cards, "Winnings applied", { { "lucky7s", lucky7Count }, { "base", getBaseReward() },
+            { "multiplier", accumulatedMultiplier }, { "reward", finalReward } });
+    }
+    else {
+        LOG_INFO(Cards, "Not enough lucky 7s to win a reward", { { "lucky7s", lucky7Count } });
+    }
+
+    winningsApplied = true;
+
+    // Reset multiplier and lucky7 counter for next card
+    accumulatedMultiplier = 1.f;
+    lucky7Count = 0;
+}
+
+// Restore the unscratched state, keeping assigned prizes
+void ScratchCardModel::reset() {
+    mask.reset();
+
+    for (auto& zone : zones) {
+        zone.revealed = false;
+        zone.applied = false;
+    }
+    revealedZoneCount = 0;
+
+    fullyRevealed = false;
+    winningsApplied = false;
+    accumulatedMoney = 0;
+    accumulatedMultiplier = 1.f;
+    lucky7Count = 0;
+}
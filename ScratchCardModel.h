@@ -0,0 +1,126 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Prize.h"
+#include "PrizeRules.h"
+#include "Random.h"
+#include "ScratchMask.h"
+#include "ZoneDetector.h"
+
+class Player;
+
+// Geometry shared by every card built from the same overlay: zone bounds and the scratch mask layout
+struct CardLayout {
+    std::vector<ZoneDetector::Zone> zones;            // Ordered left to right
+    std::shared_ptr<const ScratchMask::Layout> mask;  // Initial cleared bits and zone label map
+
+    // Detect zones in RGBA overlay pixels and build the mask layout from them
+    static std::shared_ptr<const CardLayout> fromOverlay(const std::uint8_t* rgba, unsigned int width, unsigned int height);
+
+    // Build from zones and a label map detected ahead of time (e.g. baked into an asset pack)
+    static std::shared_ptr<const CardLayout> fromZones(const std::uint8_t* rgba, unsigned int width, unsigned int height,
+        std::vector<ZoneDetector::Zone> zones, std::vector<std::uint32_t> labels);
+};
+
+// Game rules of one scratch card with no graphics or file I/O: scratch progress, zone reveal,
+// prize assignment and payout. Cheap to construct from a shared layout and freely copyable,
+// so payouts can be evaluated without a window; ScratchCard renders a model on screen.
+class ScratchCardModel {
+public:
+    ScratchCardModel() = default;
+
+    // Create an unscratched card with no prizes assigned
+    explicit ScratchCardModel(std::shared_ptr<const CardLayout> layout);
+
+    unsigned int getWidth() const { return mask.getWidth(); }
+    unsigned int getHeight() const { return mask.getHeight(); }
+
+    size_t getZoneCount() const { return zones.size(); }
+    const ZoneDetector::Zone& getZoneBounds(size_t zoneIndex) const { return layout->zones[zoneIndex]; }
+    const Prize& getZonePrize(size_t zoneIndex) const { return zones[zoneIndex].prize; }
+    bool isZoneRevealed(size_t zoneIndex) const { return zones[zoneIndex].revealed; }
+
+    // Reset per-zone state, one entry per layout zone
+    void initializeZones();
+
+    // Use different odds and payouts (the rules must outlive the model); defaults to PrizeRules::standard()
+    void setRules(const PrizeRules& prizeRules) { rules = &prizeRules; }
+    const PrizeRules& getRules() const { return *rules; }
+
+    // Assign a prize to each zone, drawing rolls from rng
+    void assignRandomPrizes(RandomStream& rng);
+
+    // Clear an already clipped span in the mask (0 <= y < height, 0 <= x0 < x1 <= width);
+    // returns number of newly cleared pixels
+    int clearClippedSpan(int y, int x0, int x1) { return mask.clearClippedSpan(y, x0, x1); }
+
+    // Check whether pixel (x, y) is cleared
+    bool isCleared(int x, int y) const { return mask.isCleared(x, y); }
+
+    // Zones touched by scratching since the last call that crossed the reveal threshold
+    void takeZonesReadyToReveal(std::vector<int>& out);
+
+    // Reveal a zone fully (clears its rect in the mask) and apply its prize if not already done
+    void revealZone(size_t zoneIndex, Player& player);
+
+    // Reveal every zone and clear the whole mask
+    void revealAll();
+
+    // Set the fully revealed flag once every zone is revealed; returns true if it was just set
+    bool updateFullyRevealed();
+
+    // Force the fully revealed flag (e.g. when auto scratch finishes)
+    void markFullyRevealed() { fullyRevealed = true; }
+
+    bool isFullyRevealed() const { return fullyRevealed; }
+
+    // Check if all zones are revealed
+    bool isFullyScratched() const { return revealedZoneCount == zones.size(); }
+
+    // Percentage of the card scratched off (0 to 100)
+    float getScratchCompletionPercent() const;
+
+    // Percentage of a zone's pixels that have been cleared (0 to 100)
+    float getZoneClearedPercent(size_t zoneIndex) const;
+
+    // Base reward for the number of lucky 7s revealed so far
+    int getBaseReward() const;
+
+    // Reward the revealed lucky 7s and multipliers are worth right now
+    int computeReward() const;
+
+    // Apply winnings to player balance, once
+    void applyWinningsToPlayer(Player& player);
+
+    bool areWinningsApplied() const { return winningsApplied; }
+    int getAccumulatedMoney() const { return accumulatedMoney; }
+    float getAccumulatedMultiplier() const { return accumulatedMultiplier; }
+
+    // Restore the unscratched state, keeping assigned prizes
+    void reset();
+
+private:
+    // Per-card state of a scratch zone; bounds and pixel counts live in the layout
+    struct Zone {
+        bool revealed = false;     // Has zone been revealed (fully scratched)
+        bool applied = false;      // Have prizes in this zone been applied to player
+        Prize prize;               // Prize assigned to this zone
+    };
+
+    std::shared_ptr<const CardLayout> layout;
+    const PrizeRules* rules = &PrizeRules::standard();
+    ScratchMask mask;                 // Bit mask tracking scratched pixels and per-zone progress
+
+    std::vector<Zone> zones;          // Parallel to layout->zones
+    size_t revealedZoneCount = 0;     // Number of zones with revealed == true
+    bool fullyRevealed = false;
+
+    std::vector<int> touchedZones;    // Reused buffer of zones touched since the last check
+
+    // Accumulated winnings state
+    int accumulatedMoney = 0;
+    float accumulatedMultiplier = 1.f;
+    bool winningsApplied = false;
+    int lucky7Count = 0;
+};
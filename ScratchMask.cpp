@@ -0,0 +1,221 @@
+#include "ScratchMask.h"
+
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+    // Number of set bits in a 64-bit word
+    int popcount64(std::uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<int>(__popcnt64(v));
+#elif defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(v);
+#else
+        v = v - ((v >> 1) & 0x5555555555555555ull);
+        v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<int>((v * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    // Index of the lowest set bit; v must be non-zero
+    int lowestBit64(std::uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, v);
+        return static_cast<int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(v);
+#else
+        return popcount64((v & (~v + 1)) - 1);
+#endif
+    }
+
+    // Word with bits [from, to) set; requires from < 64 and to <= 64
+    std::uint64_t bitRange(unsigned int from, unsigned int to) {
+        std::uint64_t upper = (to >= 64) ? ~0ull : ((1ull << to) - 1);
+        return upper & ~((1ull << from) - 1);
+    }
+}
+
+// Build a layout from RGBA pixels and a zone label map (empty for no zones)
+std::shared_ptr<const ScratchMask::Layout> ScratchMask::buildLayout(const std::uint8_t* rgba,
+    unsigned int width, unsigned int height, std::vector<std::uint32_t> labels, int zoneCount) {
+    auto layout = std::make_shared<Layout>();
+    layout->width = width;
+    layout->height = height;
+    layout->wordsPerRow = (width + 63) / 64;
+    layout->initialBits.assign(static_cast<size_t>(layout->wordsPerRow) * height, 0);
+
+    // Transparent pixels start out cleared
+    for (unsigned int y = 0; y < height; ++y) {
+        std::uint64_t* row = &layout->initialBits[static_cast<size_t>(y) * layout->wordsPerRow];
+        const std::uint8_t* alpha = rgba + static_cast<size_t>(y) * width * 4 + 3;
+
+        for (unsigned int x = 0; x < width; ++x, alpha += 4) {
+            if (*alpha == 0) {
+                row[x >> 6] |= 1ull << (x & 63);
+                ++layout->initialClearedCount;
+            }
+        }
+    }
+
+    // Count each zone's pixels, and those of them that start out cleared
+    layout->zoneTotals.assign(zoneCount, 0);
+    layout->zoneInitialCleared.assign(zoneCount, 0);
+    if (labels.size() == static_cast<size_t>(width) * height) {
+        for (unsigned int y = 0; y < height; ++y) {
+            const std::uint64_t* row = &layout->initialBits[static_cast<size_t>(y) * layout->wordsPerRow];
+            const std::uint32_t* rowLabels = &labels[static_cast<size_t>(y) * width];
+
+            for (unsigned int x = 0; x < width; ++x) {
+                if (rowLabels[x] == 0) continue;
+
+                ++layout->zoneTotals[rowLabels[x] - 1];
+                if ((row[x >> 6] >> (x & 63)) & 1ull) ++layout->zoneInitialCleared[rowLabels[x] - 1];
+            }
+        }
+        layout->labels = std::move(labels);
+    }
+
+    return layout;
+}
+
+// Create a mask in the layout's initial state
+ScratchMask::ScratchMask(std::shared_ptr<const Layout> maskLayout)
+    : layout(std::move(maskLayout))
+{
+    width = layout->width;
+    height = layout->height;
+    wordsPerRow = layout->wordsPerRow;
+    zones.resize(layout->zoneTotals.size());
+    bits.resize(layout->initialBits.size());
+    reset();
+}
+
+// Clear pixels [x0, x1) on row y, attributing newly cleared bits to their zones
+int ScratchMask::clearSpan(int y, int x0, int x1) {
+    if (y < 0 || y >= static_cast<int>(height)) return 0;
+
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, static_cast<int>(width));
+    if (x0 >= x1) return 0;
+
+    return clearClippedSpan(y, x0, x1);
+}
+
+// Clear an already clipped span a word at a time: partial edge words are masked,
+// interior words are overwritten with ones and popcount gives the newly cleared tally
+int ScratchMask::clearClippedSpan(int y, int x0, int x1) {
+    const unsigned int firstWord = static_cast<unsigned int>(x0) >> 6;
+    const unsigned int lastWord = static_cast<unsigned int>(x1 - 1) >> 6;
+    const unsigned int lastBit = ((x1 - 1) & 63) + 1;
+
+    int newlyCleared = 0;
+    if (firstWord == lastWord) {
+        newlyCleared = clearWordBits(y, firstWord, bitRange(x0 & 63, lastBit));
+    }
+    else {
+        newlyCleared = clearWordBits(y, firstWord, bitRange(x0 & 63, 64));
+
+        std::uint64_t* row = &bits[static_cast<size_t>(y) * wordsPerRow];
+        for (unsigned int w = firstWord + 1; w < lastWord; ++w) {
+            const std::uint64_t fresh = ~row[w];
+            row[w] = ~0ull;
+            newlyCleared += popcount64(fresh);
+
+            if (fresh != 0 && !layout->labels.empty()) {
+                creditZones(y, w, fresh);
+            }
+        }
+
+        newlyCleared += clearWordBits(y, lastWord, bitRange(0, lastBit));
+    }
+
+    clearedCount += newlyCleared;
+    return newlyCleared;
+}
+
+// Set the given bits in word w of row y; returns how many were newly set
+int ScratchMask::clearWordBits(int y, unsigned int w, std::uint64_t wordBits) {
+    std::uint64_t& word = bits[static_cast<size_t>(y) * wordsPerRow + w];
+    const std::uint64_t fresh = wordBits & ~word;
+    if (fresh == 0) return 0;
+
+    word |= fresh;
+    if (!layout->labels.empty()) {
+        creditZones(y, w, fresh);
+    }
+    return popcount64(fresh);
+}
+
+// Clear every pixel inside the rectangle; returns number of newly cleared pixels
+int ScratchMask::clearRect(int left, int top, int w, int h) {
+    int newlyCleared = 0;
+    for (int y = top; y < top + h; ++y) {
+        newlyCleared += clearSpan(y, left, left + w);
+    }
+    return newlyCleared;
+}
+
+// Clear the whole mask (bulk word fill)
+void ScratchMask::clearAll() {
+    std::fill(bits.begin(), bits.end(), ~0ull);
+    clearedCount = getPixelCount();
+
+    for (size_t i = 0; i < zones.size(); ++i) {
+        zones[i].cleared = layout->zoneTotals[i];
+    }
+}
+
+// Restore the layout's initial state (bulk word copy)
+void ScratchMask::reset() {
+    if (!layout) return;
+
+    std::copy(layout->initialBits.begin(), layout->initialBits.end(), bits.begin());
+    clearedCount = layout->initialClearedCount;
+
+    for (size_t i = 0; i < zones.size(); ++i) {
+        zones[i].cleared = layout->zoneInitialCleared[i];
+        zones[i].touched = false;
+    }
+    touchedZones.clear();
+}
+
+// Check whether pixel (x, y) is cleared
+bool ScratchMask::isCleared(int x, int y) const {
+    const std::uint64_t word = bits[static_cast<size_t>(y) * wordsPerRow + (static_cast<unsigned int>(x) >> 6)];
+    return (word >> (x & 63)) & 1ull;
+}
+
+// Swap out the list of zones touched since the last call
+void ScratchMask::takeTouchedZones(std::vector<int>& out) {
+    out.clear();
+    out.swap(touchedZones);
+
+    for (int zone : out) {
+        zones[zone].touched = false;
+    }
+}
+
+// Attribute newly cleared bits of word w on row y to the zones that own those pixels
+void ScratchMask::creditZones(int y, unsigned int w, std::uint64_t fresh) {
+    const std::uint32_t* wordLabels = &layout->labels[static_cast<size_t>(y) * width + w * 64];
+
+    while (fresh != 0) {
+        const std::uint32_t label = wordLabels[lowestBit64(fresh)];
+        fresh &= fresh - 1;
+        if (label == 0) continue;
+
+        ZoneCounter& zone = zones[label - 1];
+        ++zone.cleared;
+        if (!zone.touched) {
+            zone.touched = true;
+            touchedZones.push_back(static_cast<int>(label - 1));
+        }
+    }
+}
+
@@ -0,0 +1,99 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Bit-packed scratch state for a card overlay.
+// One bit per pixel, stored row-major in 64-bit words; a set bit means the pixel
+// is cleared (scratched off, or transparent in the overlay to begin with).
+// A per-pixel zone label map attributes every flipped pixel to the zone that owns it,
+// so cleared counts for the whole mask and for each zone are updated at the moment
+// bits flip and progress queries never rescan pixels.
+// Everything derived from the overlay lives in a Layout shared by all masks built from it,
+// so a mask instance only owns its bits and counters.
+class ScratchMask {
+public:
+    // Immutable data shared by every mask built from the same overlay
+    struct Layout {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        unsigned int wordsPerRow = 0;
+        std::vector<std::uint64_t> initialBits;   // Transparent overlay pixels start out cleared
+        int initialClearedCount = 0;
+        std::vector<std::uint32_t> labels;        // Row-major zone label per pixel: 0 = none, i + 1 = zone i
+        std::vector<int> zoneTotals;              // Pixels labeled with each zone
+        std::vector<int> zoneInitialCleared;      // Zone pixels already cleared in initialBits
+    };
+
+    // Build a layout from RGBA pixels and a zone label map (empty for no zones)
+    static std::shared_ptr<const Layout> buildLayout(const std::uint8_t* rgba, unsigned int width, unsigned int height,
+        std::vector<std::uint32_t> labels, int zoneCount);
+
+    ScratchMask() = default;
+
+    // Create a mask in the layout's initial state
+    explicit ScratchMask(std::shared_ptr<const Layout> layout);
+
+    // Clear pixels [x0, x1) on row y (clipped to the mask); returns number of newly cleared pixels
+    int clearSpan(int y, int x0, int x1);
+
+    // Same as clearSpan for a span the caller has already clipped: 0 <= y < height, 0 <= x0 < x1 <= width
+    int clearClippedSpan(int y, int x0, int x1);
+
+    // Clear every pixel inside the rectangle; returns number of newly cleared pixels
+    int clearRect(int left, int top, int width, int height);
+
+    // Clear the whole mask (bulk word fill)
+    void clearAll();
+
+    // Restore the layout's initial state (bulk word copy)
+    void reset();
+
+    // Check whether pixel (x, y) is cleared
+    bool isCleared(int x, int y) const;
+
+    unsigned int getWidth() const { return width; }
+    unsigned int getHeight() const { return height; }
+
+    // Total number of pixels covered by the mask
+    int getPixelCount() const { return static_cast<int>(width * height); }
+
+    // Number of cleared pixels across the whole mask
+    int getClearedCount() const { return clearedCount; }
+
+    // Number of cleared pixels belonging to the given zone
+    int getZoneClearedCount(int zone) const { return zones[zone].cleared; }
+
+    // Number of pixels belonging to the given zone
+    int getZonePixelCount(int zone) const { return layout->zoneTotals[zone]; }
+
+    // Zones that had pixels cleared since the last takeTouchedZones call.
+    // The list is swapped into out (reusing its capacity) and reset.
+    void takeTouchedZones(std::vector<int>& out);
+
+private:
+    // Per-zone bookkeeping
+    struct ZoneCounter {
+        int cleared = 0;          // Currently cleared pixels
+        bool touched = false;     // Listed in touchedZones
+    };
+
+    std::shared_ptr<const Layout> layout;
+
+    // Copied from the layout for the hot paths
+    unsigned int width = 0;
+    unsigned int height = 0;
+    unsigned int wordsPerRow = 0;
+
+    std::vector<std::uint64_t> bits;         // Current cleared bits
+    int clearedCount = 0;
+
+    std::vector<ZoneCounter> zones;
+    std::vector<int> touchedZones;
+
+    // Attribute newly cleared bits of word w on row y to their zones
+    void creditZones(int y, unsigned int w, std::uint64_t fresh);
+
+    // Set the given bits in word w of row y; returns how many were newly set
+    int clearWordBits(int y, unsigned int w, std::uint64_t wordBits);
+};
@@ -1,6 +1,5 @@
 #include "Shop.h"
-#include "Utils.h"
-#include <cstdlib>
+#include "Random.h"
 
 // Populate shop with new random relic and card offers
 void Shop::generateNewShop() {
@@ -26,14 +25,10 @@ int Shop::getRerollCost() const { return rerollCost; }
 const std::vector<Relic>& Shop::getRelics() const { return relicOffers; }
 const std::vector<ScratchCardOffer>& Shop::getScratchCards() const { return cardOffers; }
 
-// Return a random relic from a predefined pool
+// Return a random relic from the relic definitions
 Relic Shop::generateRandomRelic() {
-    static const std::vector<Relic> relicPool = {
-        {"lucky_coin", "Lucky Coin", "Increases winnings by 10%", 50},
-        {"golden_ticket", "Golden Ticket", "Unlocks rare cards", 100},
-        {"mystery_box", "Mystery Box", "Random effect each game", 75}
-    };
-    return relicPool[rand() % relicPool.size()];
+    const std::vector<Relic>& relicPool = Relic::definitions();
+    return relicPool[Random::shop().below(static_cast<std::uint32_t>(relicPool.size()))];
 }
 
 // Return a random scratch card offer from a predefined pool
@@ -60,6 +55,6 @@ ScratchCardOffer Shop::generateRandomCard() {
     };
 
     // Pick random card offer
-    int idx = Utils::randInt(0, static_cast<int>(cardPool.size()) - 1);
+    int idx = Random::shop().range(0, static_cast<int>(cardPool.size()) - 1);
     return cardPool[idx];
 }
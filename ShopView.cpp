@@ -1,6 +1,8 @@
 #include "ShopView.h"
 #include "Player.h"
-#include <random>
+#include "Random.h"
+#include "Log.h"
+#include "Profiler.h"
 
 // Constants
 constexpr float GAME_PIXEL_SCALE = 3.f;
@@ -9,8 +11,9 @@ constexpr float SCREEN_HEIGHT = 720.f;
 
 ShopView::ShopView() : font(ResourceManager::getFont("mainFont")) {
     // Setup background
-    background.setTexture(ResourceManager::getTexture("shop_bg"));
-    sf::Vector2u texSize = background.getTexture()->getSize(); // e.g. 128x128
+    ResourceManager::setSpriteTexture(background, "shop_bg");
+    const sf::IntRect texRect = background.getTextureRect(); // e.g. 128x128
+    const sf::Vector2f texSize(static_cast<float>(texRect.width), static_cast<float>(texRect.height));
     background.setScale(GAME_PIXEL_SCALE, GAME_PIXEL_SCALE);
     background.setPosition(
         (SCREEN_WIDTH - texSize.x * GAME_PIXEL_SCALE) / 2.f,
@@ -45,11 +48,11 @@ ShopView::ShopView() : font(ResourceManager::getFont("mainFont")) {
     }
 
     // Setup reroll button near bottom center
-    rerollButton.setTexture(ResourceManager::getTexture("reroll_button"));
+    ResourceManager::setSpriteTexture(rerollButton, "reroll_button");
     rerollButton.setScale(GAME_PIXEL_SCALE, GAME_PIXEL_SCALE);
 
-    float buttonWidth = rerollButton.getTexture()->getSize().x * GAME_PIXEL_SCALE;
-    float buttonHeight = rerollButton.getTexture()->getSize().y * GAME_PIXEL_SCALE;
+    float buttonWidth = rerollButton.getTextureRect().width * GAME_PIXEL_SCALE;
+    float buttonHeight = rerollButton.getTextureRect().height * GAME_PIXEL_SCALE;
 
     rerollButtonPos = sf::Vector2f(
         (SCREEN_WIDTH - buttonWidth) / 2.f,
@@ -58,7 +61,7 @@ ShopView::ShopView() : font(ResourceManager::getFont("mainFont")) {
     rerollButton.setPosition(rerollButtonPos);
 
     // Setup next round button below reroll button
-    nextRoundButton.setTexture(ResourceManager::getTexture("next_round_button"));
+    ResourceManager::setSpriteTexture(nextRoundButton, "next_round_button");
     nextRoundButton.setScale(GAME_PIXEL_SCALE, GAME_PIXEL_SCALE);
 
     nextRoundButtonPos = sf::Vector2f(
@@ -87,11 +90,12 @@ void ShopView::reroll() {
         item.price = getPriceForRarity(item.rarity);
 
         // Setup sprite icon for the shop preview
-        item.icon.setTexture(ResourceManager::getTexture(item.id));
-        sf::Vector2u texSize = item.icon.getTexture()->getSize();
-        item.icon.setOrigin(texSize.x / 2.f, texSize.y / 2.f);
+        ResourceManager::setSpriteTexture(item.icon, item.id);
+        const sf::IntRect& iconRect = item.icon.getTextureRect();
+        item.icon.setOrigin(iconRect.width / 2.f, iconRect.height / 2.f);
         item.icon.setPosition(cardPositions[i]);
         item.icon.setScale(GAME_PIXEL_SCALE, GAME_PIXEL_SCALE);
+        updatePriceLabel(item);
 
         items.push_back(item);
     }
@@ -102,38 +106,55 @@ void ShopView::reroll() {
     for (int i = 0; i < 2; ++i) {
         ShopItem item;
         item.type = ShopItem::Type::Relic;
-        item.id = "relic_" + std::to_string(rand() % 5); // random relic id from relic_0 to relic_4
-        item.price = 20 + rand() % 10;                   // price between 20 and 29
+        const std::vector<Relic>& relics = Relic::definitions();
+        item.id = relics[Random::shop().below(static_cast<std::uint32_t>(relics.size()))].id;
+        item.price = Random::shop().range(20, 29);                     // price between 20 and 29
 
         // Use fixed relic texture slots (relic_1, relic_2)
-        item.icon.setTexture(ResourceManager::getTexture("relic_" + std::to_string(i + 1)));
-        sf::Vector2u texSize = item.icon.getTexture()->getSize();
-        item.icon.setOrigin(texSize.x / 2.f, texSize.y / 2.f);
+        ResourceManager::setSpriteTexture(item.icon, "relic_" + std::to_string(i + 1));
+        const sf::IntRect& iconRect = item.icon.getTextureRect();
+        item.icon.setOrigin(iconRect.width / 2.f, iconRect.height / 2.f);
         item.icon.setPosition(relicPositions[i]);
         item.icon.setScale(GAME_PIXEL_SCALE, GAME_PIXEL_SCALE);
+        updatePriceLabel(item);
 
         items.push_back(item);
     }
 }
 
-void ShopView::draw(sf::RenderTarget& target) {
-    target.draw(background);
-
+void ShopView::draw(sf::RenderTarget& target, SpriteBatch& batch) {
+    PROFILE_ZONE("ShopView::draw");
+    batch.draw(background, SpriteLayer::Background);
     for (const auto& item : items) {
-        target.draw(item.icon);
-
-        // Set price text string and center it horizontally under the icon
-        priceText.setString("" + std::to_string(item.price));
-        sf::FloatRect bounds = priceText.getLocalBounds();
-        priceText.setOrigin(bounds.width / 2.f, 0.f);
+        batch.draw(item.icon, SpriteLayer::Ui);
+    }
+    batch.flush(target);
 
-        float yOffset = (item.type == ShopItem::Type::Relic) ? 10.f * GAME_PIXEL_SCALE : 25.f * GAME_PIXEL_SCALE;
-        priceText.setPosition(item.icon.getPosition().x, item.icon.getPosition().y + yOffset);
-        target.draw(priceText);
+    for (auto& item : items) {
+        // Relics bought since the last frame may have changed the price
+        updatePriceLabel(item);
+        target.draw(item.priceLabel);
     }
 
-    target.draw(rerollButton);
-    target.draw(nextRoundButton);
+    // Buttons stay on top of the price texts
+    batch.draw(rerollButton, SpriteLayer::Ui);
+    batch.draw(nextRoundButton, SpriteLayer::Ui);
+    batch.flush(target);
+}
+
+void ShopView::updatePriceLabel(ShopItem& item) {
+    const int price = getPrice(item);
+    if (price == item.shownPrice) return;
+    item.shownPrice = price;
+
+    // Copy the shared style, then center the text horizontally under the icon
+    item.priceLabel = priceText;
+    item.priceLabel.setString("" + std::to_string(price));
+    sf::FloatRect bounds = item.priceLabel.getLocalBounds();
+    item.priceLabel.setOrigin(bounds.width / 2.f, 0.f);
+
+    float yOffset = (item.type == ShopItem::Type::Relic) ? 10.f * GAME_PIXEL_SCALE : 25.f * GAME_PIXEL_SCALE;
+    item.priceLabel.setPosition(item.icon.getPosition().x, item.icon.getPosition().y + yOffset);
 }
 
 void ShopView::handleClick(float x, float y, Player& player) {
@@ -148,32 +169,34 @@ void ShopView::handleClick(float x, float y, Player& player) {
         if (it->icon.getGlobalBounds().contains(x, y)) {
             if (it->type == ShopItem::Type::Card) {
                 if (cardsBought >= 3) {
-                    std::cout << "You can only buy 3 cards before rerolling.\n";
+                    LOG_INFO(Shop, "You can only buy 3 cards before rerolling");
                     return;
                 }
-                if (player.getBalance() >= it->price) {
-                    player.addBalance(-it->price);
+                const int price = getPrice(*it);
+                if (player.getBalance() >= price) {
+                    player.addBalance(-price);
                     cardsBought++;
                     player.addCard(it->id); // Add card by its shop preview ID
-                    std::cout << "Bought card: " << it->id << " for " << it->price << "\n";
+                    LOG_INFO(Shop, "Bought card", { { "id", it->id }, { "price", price } });
                     it = items.erase(it);
                     return;
                 }
                 else {
-                    std::cout << "Not enough money to buy card.\n";
+                    LOG_INFO(Shop, "Not enough money to buy card", { { "price", price }, { "balance", player.getBalance() } });
                     return;
                 }
             }
             else if (it->type == ShopItem::Type::Relic) {
-                if (player.getBalance() >= it->price) {
-                    player.addBalance(-it->price);
+                const int price = getPrice(*it);
+                if (player.getBalance() >= price) {
+                    player.addBalance(-price);
                     player.addRelic(it->id);
-                    std::cout << "Bought relic: " << it->id << " for " << it->price << "\n";
+                    LOG_INFO(Shop, "Bought relic", { { "id", it->id }, { "price", price } });
                     it = items.erase(it);
                     return;
                 }
                 else {
-                    std::cout << "Not enough money to buy relic.\n";
+                    LOG_INFO(Shop, "Not enough money to buy relic", { { "price", price }, { "balance", player.getBalance() } });
                     return;
                 }
             }
@@ -191,6 +214,10 @@ void ShopView::handleClick(float x, float y, Player& player) {
     }
 }
 
+int ShopView::getPrice(const ShopItem& item) const {
+    return relicPlan ? relicPlan->getShopPrice(item.price) : item.price;
+}
+
 int ShopView::getPriceForRarity(const std::string& rarity) {
     if (rarity == "Common") return 3;
     if (rarity == "Uncommon") return 5;
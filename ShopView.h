@@ -6,13 +6,17 @@
 #include "CardTypes.h"
 #include "ResourceManager.h"
 #include "Player.h"
+#include "SpriteBatch.h"
+#include "RelicPlan.h"
 
 // Represents an item in the shop (either card or relic)
 struct ShopItem {
     enum class Type { Card, Relic } type;
     std::string id;         // Unique ID string for resource lookup
-    int price;              // Price in game currency
+    int price;              // Base price in game currency, before relic modifiers
     sf::Sprite icon;        // Sprite used to render the item
+    sf::Text priceLabel;    // Price under the icon, rebuilt only when the price changes
+    int shownPrice = -1;    // Price priceLabel currently shows
 
     // Only relevant for cards
     std::string rarity;     // e.g. "Common", "Uncommon", "Rare"
@@ -27,12 +31,19 @@ public:
     // Generate new shop items (cards + relics)
     void reroll();
 
-    // Draw the shop UI (background, items, buttons, prices)
-    void draw(sf::RenderTarget& target);
+    // Draw the shop UI (background, items, prices, then buttons on top); sprites go through the batch,
+    // flushed once before the price texts and once for the buttons
+    void draw(sf::RenderTarget& target, SpriteBatch& batch);
 
     // Handle mouse click at (x,y), purchase items, or activate buttons
     void handleClick(float x, float y, Player& player);
 
+    // Relic modifiers applied to displayed and charged prices (the plan must outlive the view); none by default
+    void setRelicPlan(const RelicPlan* plan) { relicPlan = plan; }
+
+    // Price of an item after relic modifiers
+    int getPrice(const ShopItem& item) const;
+
     int getCardsBought() const { return cardsBought; }
     void resetCardsBought() { cardsBought = 0; }
 
@@ -41,7 +52,7 @@ public:
 
 private:
     sf::Font font;
-    sf::Text priceText;
+    sf::Text priceText;              // Style copied into every price label
     sf::Sprite background;
     sf::Sprite rerollButton;
     sf::Sprite nextRoundButton;
@@ -56,7 +67,11 @@ private:
     std::vector<ShopItem> items;     // Currently displayed shop items
 
     int cardsBought = 0;
+    const RelicPlan* relicPlan = nullptr;
 
     // Helpers (implementations omitted here)
     int getPriceForRarity(const std::string& rarity);
+
+    // Rebuild an item's price label if its price after relic modifiers changed
+    void updatePriceLabel(ShopItem& item);
 };
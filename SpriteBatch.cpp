@@ -0,0 +1,97 @@
+#include "SpriteBatch.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+void SpriteBatch::draw(const sf::Sprite& sprite, SpriteLayer layer) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    // Same corners sf::Sprite would emit: local rect through the sprite's transform
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const float width = static_cast<float>(std::abs(rect.width));
+    const float height = static_cast<float>(std::abs(rect.height));
+    const sf::Transform& transform = sprite.getTransform();
+
+    const sf::Vector2f corners[4] = {
+        transform.transformPoint(0.f, 0.f),
+        transform.transformPoint(width, 0.f),
+        transform.transformPoint(width, height),
+        transform.transformPoint(0.f, height)
+    };
+    const sf::FloatRect uv(static_cast<float>(rect.left), static_cast<float>(rect.top),
+        static_cast<float>(rect.width), static_cast<float>(rect.height));
+
+    appendQuad(bucketFor(layer, texture), corners, uv, sprite.getColor());
+}
+
+void SpriteBatch::draw(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::FloatRect& dest,
+    SpriteLayer layer, sf::Color color) {
+    const sf::Vector2f corners[4] = {
+        sf::Vector2f(dest.left, dest.top),
+        sf::Vector2f(dest.left + dest.width, dest.top),
+        sf::Vector2f(dest.left + dest.width, dest.top + dest.height),
+        sf::Vector2f(dest.left, dest.top + dest.height)
+    };
+    const sf::FloatRect uv(static_cast<float>(textureRect.left), static_cast<float>(textureRect.top),
+        static_cast<float>(textureRect.width), static_cast<float>(textureRect.height));
+
+    appendQuad(bucketFor(layer, &texture), corners, uv, color);
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    PROFILE_ZONE("SpriteBatch::flush");
+    // Layers in order; within a layer, buckets keep the order they were created in
+    drawOrder.clear();
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (buckets[i].vertices.getVertexCount() > 0) drawOrder.push_back(i);
+    }
+    std::stable_sort(drawOrder.begin(), drawOrder.end(), [this](size_t a, size_t b) {
+        return buckets[a].layer < buckets[b].layer;
+    });
+
+    for (size_t index : drawOrder) {
+        Bucket& bucket = buckets[index];
+        const size_t vertexCount = bucket.vertices.getVertexCount();
+
+        target.draw(bucket.vertices, sf::RenderStates(bucket.texture));
+        ++stats.drawCalls;
+        stats.vertices += vertexCount;
+        stats.quads += vertexCount / 6;
+
+        bucket.vertices.clear();
+    }
+}
+
+// Find or create the bucket for (layer, texture); consecutive quads usually share one
+sf::VertexArray& SpriteBatch::bucketFor(SpriteLayer layer, const sf::Texture* texture) {
+    if (lastBucket < buckets.size() && buckets[lastBucket].layer == layer && buckets[lastBucket].texture == texture) {
+        return buckets[lastBucket].vertices;
+    }
+
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        if (buckets[i].layer == layer && buckets[i].texture == texture) {
+            lastBucket = i;
+            return buckets[i].vertices;
+        }
+    }
+
+    buckets.push_back({ layer, texture, sf::VertexArray(sf::Triangles) });
+    lastBucket = buckets.size() - 1;
+    return buckets.back().vertices;
+}
+
+void SpriteBatch::appendQuad(sf::VertexArray& vertices, const sf::Vector2f corners[4], const sf::FloatRect& uv, sf::Color color) {
+    const sf::Vector2f uv0(uv.left, uv.top);
+    const sf::Vector2f uv1(uv.left + uv.width, uv.top);
+    const sf::Vector2f uv2(uv.left + uv.width, uv.top + uv.height);
+    const sf::Vector2f uv3(uv.left, uv.top + uv.height);
+
+    vertices.append(sf::Vertex(corners[0], color, uv0));
+    vertices.append(sf::Vertex(corners[1], color, uv1));
+    vertices.append(sf::Vertex(corners[2], color, uv2));
+    vertices.append(sf::Vertex(corners[0], color, uv0));
+    vertices.append(sf::Vertex(corners[2], color, uv2));
+    vertices.append(sf::Vertex(corners[3], color, uv3));
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Draw order buckets; a lower layer is always drawn before a higher one
+enum class SpriteLayer {
+    Background,
+    Base,
+    Symbols,
+    Ui
+};
+
+// Queues textured quads and draws them as one vertex array per texture per layer.
+// Quads in the same layer may be reordered across textures, so anything that must
+// overlap in a fixed order goes in separate layers. Call flush() before drawing
+// non-batched things (text, render textures) that have to sit on top of the queue.
+class SpriteBatch {
+public:
+    // Work done by flush() since the last resetStats()
+    struct Stats {
+        size_t drawCalls = 0;
+        size_t vertices = 0;
+        size_t quads = 0;
+    };
+
+    // Queue a sprite as it would be drawn by target.draw(sprite); sprites without a texture are skipped
+    void draw(const sf::Sprite& sprite, SpriteLayer layer);
+
+    // Queue an axis-aligned quad showing textureRect of texture stretched over dest
+    void draw(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::FloatRect& dest,
+        SpriteLayer layer, sf::Color color = sf::Color::White);
+
+    // Draw everything queued, layer by layer, then empty the queue (buffers are kept)
+    void flush(sf::RenderTarget& target);
+
+    const Stats& getStats() const { return stats; }
+    void resetStats() { stats = Stats(); }
+
+private:
+    // All quads queued for one (layer, texture) pair, as triangles
+    struct Bucket {
+        SpriteLayer layer;
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    std::vector<Bucket> buckets;     // Kept across frames so vertex storage is reused; empty ones are skipped
+    std::vector<size_t> drawOrder;   // Bucket indices sorted by layer at flush
+    size_t lastBucket = 0;           // Most recently used bucket, checked first
+
+    Stats stats;
+
+    sf::VertexArray& bucketFor(SpriteLayer layer, const sf::Texture* texture);
+    static void appendQuad(sf::VertexArray& vertices, const sf::Vector2f corners[4], const sf::FloatRect& uv, sf::Color color);
+};
@@ -0,0 +1,121 @@
+#include "TextureAtlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    // Horizontal strip of a page holding images no taller than its height
+    struct Shelf {
+        unsigned int page;
+        unsigned int top;
+        unsigned int height;
+        unsigned int used;     // Width taken so far
+    };
+
+    // Smallest power of two >= value
+    unsigned int nextPowerOfTwo(unsigned int value) {
+        unsigned int result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+
+    // Copy an image into a page at (left, top) and extrude its edges into the padding around it
+    void blit(TextureAtlas::Page& page, const TextureAtlas::Input& input, int left, int top, int padding) {
+        const int width = static_cast<int>(input.width);
+        const int height = static_cast<int>(input.height);
+        const size_t pageStride = static_cast<size_t>(page.width) * 4;
+        const size_t stride = input.stride ? input.stride : static_cast<size_t>(width) * 4;
+
+        for (int y = -padding; y < height + padding; ++y) {
+            const int srcY = std::min(std::max(y, 0), height - 1);
+            const std::uint8_t* srcRow = input.rgba + static_cast<size_t>(srcY) * stride;
+            std::uint8_t* dstRow = page.rgba.data() + static_cast<size_t>(top + y) * pageStride;
+
+            std::memcpy(dstRow + static_cast<size_t>(left) * 4, srcRow, static_cast<size_t>(width) * 4);
+            for (int x = 1; x <= padding; ++x) {
+                std::memcpy(dstRow + static_cast<size_t>(left - x) * 4, srcRow, 4);
+                std::memcpy(dstRow + static_cast<size_t>(left + width - 1 + x) * 4, srcRow + static_cast<size_t>(width - 1) * 4, 4);
+            }
+        }
+    }
+}
+
+namespace TextureAtlas {
+    Result pack(const std::vector<Input>& inputs, unsigned int maxPageSize, unsigned int padding) {
+        Result result;
+        result.placements.resize(inputs.size());
+
+        // Page width: enough for the total padded area to form a rough square, within the limit
+        std::vector<size_t> order;
+        size_t totalArea = 0;
+        unsigned int widest = 0;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const unsigned int w = inputs[i].width + 2 * padding;
+            const unsigned int h = inputs[i].height + 2 * padding;
+            if (inputs[i].width == 0 || inputs[i].height == 0 || w > maxPageSize || h > maxPageSize) continue;
+
+            order.push_back(i);
+            totalArea += static_cast<size_t>(w) * h;
+            widest = std::max(widest, w);
+        }
+        if (order.empty()) return result;
+
+        const unsigned int side = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<double>(totalArea))));
+        const unsigned int pageWidth = std::min(maxPageSize, nextPowerOfTwo(std::max(side, widest)));
+
+        // Tallest first keeps shelves tight; ties broken by width for a stable layout
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (inputs[a].height != inputs[b].height) return inputs[a].height > inputs[b].height;
+            if (inputs[a].width != inputs[b].width) return inputs[a].width > inputs[b].width;
+            return a < b;
+        });
+
+        // First fit over open shelves, then a new shelf, then a new page
+        std::vector<Shelf> shelves;
+        std::vector<unsigned int> pageHeights;
+        for (size_t index : order) {
+            const unsigned int w = inputs[index].width + 2 * padding;
+            const unsigned int h = inputs[index].height + 2 * padding;
+
+            Shelf* target = nullptr;
+            for (auto& shelf : shelves) {
+                if (shelf.height >= h && shelf.used + w <= pageWidth) {
+                    target = &shelf;
+                    break;
+                }
+            }
+
+            if (!target) {
+                if (pageHeights.empty() || pageHeights.back() + h > maxPageSize) pageHeights.push_back(0);
+                const unsigned int page = static_cast<unsigned int>(pageHeights.size() - 1);
+                shelves.push_back({ page, pageHeights.back(), h, 0 });
+                pageHeights.back() += h;
+                target = &shelves.back();
+            }
+
+            Placement& placement = result.placements[index];
+            placement.packed = true;
+            placement.page = target->page;
+            placement.left = static_cast<int>(target->used + padding);
+            placement.top = static_cast<int>(target->top + padding);
+            placement.width = static_cast<int>(inputs[index].width);
+            placement.height = static_cast<int>(inputs[index].height);
+            target->used += w;
+        }
+
+        // Pages start transparent; copy every image in with its extruded border
+        result.pages.resize(pageHeights.size());
+        for (size_t i = 0; i < pageHeights.size(); ++i) {
+            result.pages[i].width = pageWidth;
+            result.pages[i].height = pageHeights[i];
+            result.pages[i].rgba.assign(static_cast<size_t>(pageWidth) * pageHeights[i] * 4, 0);
+        }
+        for (size_t index : order) {
+            const Placement& placement = result.placements[index];
+            blit(result.pages[placement.page], inputs[index], placement.left, placement.top, static_cast<int>(padding));
+        }
+
+        return result;
+    }
+}
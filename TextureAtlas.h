@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Packing of many small RGBA images onto a few large atlas pages, so sprites that share a
+// page can be drawn without switching textures. Pure CPU; the caller uploads the pages.
+namespace TextureAtlas {
+    // Page limit and padding used by the game and the asset baker, so baked pages match runtime ones
+    constexpr unsigned int MAX_PAGE_SIZE = 2048;
+    constexpr unsigned int PADDING = 2;
+
+    // One RGBA image to place
+    struct Input {
+        const std::uint8_t* rgba = nullptr;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        size_t stride = 0;      // Bytes between rows; 0 = width * 4
+    };
+
+    // Where an input ended up. The rect excludes padding; packed is false for images
+    // too large for a page, which the caller should keep as standalone textures.
+    struct Placement {
+        bool packed = false;
+        unsigned int page = 0;
+        int left = 0;
+        int top = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    struct Page {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<std::uint8_t> rgba;
+    };
+
+    struct Result {
+        std::vector<Page> pages;
+        std::vector<Placement> placements;   // Same order as the inputs
+    };
+
+    // Shelf-pack the inputs, tallest first, onto pages of at most maxPageSize pixels per side.
+    // Each image is surrounded by padding pixels filled by repeating its edge pixels, so
+    // pixel-art sampling at fractional positions or scales never picks up a neighbour.
+    Result pack(const std::vector<Input>& inputs, unsigned int maxPageSize, unsigned int padding);
+}
@@ -1,25 +1,19 @@
-#include "utils.h"
+#include "Utils.h"
+#include "Random.h"
 
 namespace Utils {
-    // Ensures random seed is set once, on first call
+    // Ensures the run seed is set once, on first call
     void seedRandom() {
-        static bool seeded = false;
-        if (!seeded) {
-            std::srand(static_cast<unsigned int>(std::time(nullptr)));
-            seeded = true;
-        }
+        Random::getRunSeed();
     }
 
     // Returns random int in [min, max]
     int randInt(int min, int max) {
-        seedRandom();
-        return min + (std::rand() % (max - min + 1));
+        return Random::stream(Random::Stream::General).range(min, max);
     }
 
     // Returns random float in [min, max)
     float randFloat(float min, float max) {
-        seedRandom();
-        float scale = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-        return min + scale * (max - min);
+        return Random::stream(Random::Stream::General).uniform(min, max);
     }
 }
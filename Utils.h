@@ -1,13 +1,11 @@
 #pragma once
-#include <cstdlib>
-#include <ctime>
 
-// Utility functions for random number generation
+// Utility functions for random number generation, drawn from the run's general stream (see Random.h)
 namespace Utils {
-    // Seeds the random number generator once per program run
+    // Seeds the run's random streams once per program run (no-op if already seeded)
     void seedRandom();
 
-    // Returns a random integer in [min, max]
+    // Returns a random integer in [min, max] (unbiased)
     int randInt(int min, int max);
 
     // Returns a random float in [min, max)
@@ -0,0 +1,207 @@
+#include "ZoneDetector.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace {
+    // Horizontal run of opaque pixels [x0, x1) on row y with its provisional label
+    struct Run {
+        int y;
+        int x0;
+        int x1;
+        std::uint32_t label;
+    };
+
+    // First pass output for one band of rows
+    struct Band {
+        int top = 0;
+        int bottom = 0;                        // Exclusive
+        std::vector<Run> runs;                 // Row-major
+        std::vector<size_t> rowStart;          // Index of the first run of each row, plus an end marker
+        std::vector<std::uint32_t> parent;     // Union-find forest over provisional labels
+    };
+
+    // Root of a label, halving the path as it goes
+    std::uint32_t findRoot(std::vector<std::uint32_t>& parent, std::uint32_t label) {
+        while (parent[label] != label) {
+            parent[label] = parent[parent[label]];
+            label = parent[label];
+        }
+        return label;
+    }
+
+    // Merge two label sets, keeping the smaller label as the root
+    void unite(std::vector<std::uint32_t>& parent, std::uint32_t a, std::uint32_t b) {
+        a = findRoot(parent, a);
+        b = findRoot(parent, b);
+        if (a == b) return;
+        if (a < b) parent[b] = a;
+        else parent[a] = b;
+    }
+
+    // Union every run in [cur, curEnd) with the runs it overlaps in [prev, prevEnd) (4-connectivity)
+    void connectRows(std::vector<std::uint32_t>& parent, Run* prev, Run* prevEnd, Run* cur, Run* curEnd) {
+        for (; cur != curEnd; ++cur) {
+            while (prev != prevEnd && prev->x1 <= cur->x0) ++prev;
+            for (Run* p = prev; p != prevEnd && p->x0 < cur->x1; ++p) {
+                unite(parent, cur->label, p->label);
+            }
+        }
+    }
+
+    // First pass over one band: extract runs and union them with overlapping runs on the row above
+    void labelBand(const std::uint8_t* rgba, unsigned int width, Band& band) {
+        band.rowStart.assign(static_cast<size_t>(band.bottom - band.top) + 1, 0);
+
+        for (int y = band.top; y < band.bottom; ++y) {
+            const size_t rowBegin = band.runs.size();
+            band.rowStart[y - band.top] = rowBegin;
+
+            const std::uint8_t* alpha = rgba + static_cast<size_t>(y) * width * 4 + 3;
+            unsigned int x = 0;
+            while (x < width) {
+                while (x < width && alpha[x * 4] == 0) ++x;
+                if (x == width) break;
+
+                const unsigned int start = x;
+                while (x < width && alpha[x * 4] != 0) ++x;
+
+                const std::uint32_t label = static_cast<std::uint32_t>(band.parent.size());
+                band.parent.push_back(label);
+                band.runs.push_back({ y, static_cast<int>(start), static_cast<int>(x), label });
+            }
+
+            if (y > band.top) {
+                const size_t prevBegin = band.rowStart[y - band.top - 1];
+                Run* runs = band.runs.data();
+                connectRows(band.parent, runs + prevBegin, runs + rowBegin, runs + rowBegin, runs + band.runs.size());
+            }
+        }
+
+        band.rowStart.back() = band.runs.size();
+    }
+}
+
+namespace ZoneDetector {
+    // Label an RGBA image with a row-major, run-based two-pass union-find sweep
+    Result detect(const std::uint8_t* rgba, unsigned int width, unsigned int height, const Options& options) {
+        Result result;
+        if (rgba == nullptr || width == 0 || height == 0) return result;
+
+        // Split rows into bands; each band gets its own runs and label forest
+        const unsigned int bandCount = std::max(1u, std::min(options.bands, height));
+        std::vector<Band> bands(bandCount);
+        for (unsigned int b = 0; b < bandCount; ++b) {
+            bands[b].top = static_cast<int>(height * b / bandCount);
+            bands[b].bottom = static_cast<int>(height * (b + 1) / bandCount);
+        }
+
+        if (bandCount == 1) {
+            labelBand(rgba, width, bands[0]);
+        }
+        else {
+            std::vector<std::thread> workers;
+            workers.reserve(bandCount - 1);
+            for (unsigned int b = 1; b < bandCount; ++b) {
+                workers.emplace_back(labelBand, rgba, width, std::ref(bands[b]));
+            }
+            labelBand(rgba, width, bands[0]);
+            for (auto& worker : workers) worker.join();
+        }
+
+        // Merge the band forests into one label space
+        std::vector<std::uint32_t> parent;
+        std::vector<Run> runs;
+        std::vector<size_t> bandRunStart(bandCount + 1, 0);
+        for (unsigned int b = 0; b < bandCount; ++b) {
+            const std::uint32_t offset = static_cast<std::uint32_t>(parent.size());
+            for (std::uint32_t p : bands[b].parent) parent.push_back(p + offset);
+
+            bandRunStart[b] = runs.size();
+            for (Run run : bands[b].runs) {
+                run.label += offset;
+                runs.push_back(run);
+            }
+        }
+        bandRunStart[bandCount] = runs.size();
+
+        // Stitch each seam: last row of the band above against the first row of the band below
+        for (unsigned int b = 1; b < bandCount; ++b) {
+            const Band& above = bands[b - 1];
+            const Band& below = bands[b];
+            if (above.bottom <= above.top || below.bottom <= below.top) continue;
+
+            Run* base = runs.data();
+            Run* prev = base + bandRunStart[b - 1] + above.rowStart[above.bottom - above.top - 1];
+            Run* prevEnd = base + bandRunStart[b];
+            Run* cur = base + bandRunStart[b];
+            Run* curEnd = cur + below.rowStart[1];
+            connectRows(parent, prev, prevEnd, cur, curEnd);
+        }
+
+        // Second pass: resolve roots and gather bounds, pixel count and first column-major pixel per component
+        struct Component {
+            int left, top, right, bottom;
+            int pixelCount;
+            int firstX, firstY;
+        };
+        std::vector<std::uint32_t> rootToComponent(parent.size(), 0);
+        std::vector<Component> components;
+
+        for (Run& run : runs) {
+            const std::uint32_t root = findRoot(parent, run.label);
+            std::uint32_t& index = rootToComponent[root];
+            if (index == 0) {
+                components.push_back({ run.x0, run.y, run.x1, run.y + 1, 0, run.x0, run.y });
+                index = static_cast<std::uint32_t>(components.size());
+            }
+
+            Component& c = components[index - 1];
+            c.left = std::min(c.left, run.x0);
+            c.right = std::max(c.right, run.x1);
+            c.top = std::min(c.top, run.y);
+            c.bottom = std::max(c.bottom, run.y + 1);
+            c.pixelCount += run.x1 - run.x0;
+            if (run.x0 < c.firstX || (run.x0 == c.firstX && run.y < c.firstY)) {
+                c.firstX = run.x0;
+                c.firstY = run.y;
+            }
+            run.label = index - 1;
+        }
+
+        // Order zones as a column-major scan would find them, so zone order runs left to right
+        std::vector<std::uint32_t> order(components.size());
+        for (std::uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+        std::sort(order.begin(), order.end(), [&components](std::uint32_t a, std::uint32_t b) {
+            if (components[a].firstX != components[b].firstX) return components[a].firstX < components[b].firstX;
+            return components[a].firstY < components[b].firstY;
+        });
+
+        std::vector<std::uint32_t> componentToZone(components.size());
+        result.zones.reserve(components.size());
+        for (std::uint32_t i = 0; i < order.size(); ++i) {
+            const Component& c = components[order[i]];
+            componentToZone[order[i]] = i + 1;
+            result.zones.push_back({ c.left, c.top, c.right - c.left, c.bottom - c.top, c.pixelCount });
+        }
+
+        // Paint runs into the label map
+        result.labels.assign(static_cast<size_t>(width) * height, 0);
+        for (const Run& run : runs) {
+            std::uint32_t* row = &result.labels[static_cast<size_t>(run.y) * width];
+            std::fill(row + run.x0, row + run.x1, componentToZone[run.label]);
+        }
+
+        return result;
+    }
+
+    // Parallel bands only pay off on very large overlays
+    unsigned int suggestBandCount(unsigned int width, unsigned int height) {
+        const unsigned long long pixels = static_cast<unsigned long long>(width) * height;
+        if (pixels < (1ull << 21)) return 1;
+
+        const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+        return std::max(1u, std::min(cores, height / 256));
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Connected-component labeling of overlay alpha into scratch zones.
+// Opaque pixels (alpha > 0) that touch horizontally or vertically form one zone.
+namespace ZoneDetector {
+    // Bounds and exact pixel count of one detected zone
+    struct Zone {
+        int left = 0;
+        int top = 0;
+        int width = 0;
+        int height = 0;
+        int pixelCount = 0;
+    };
+
+    struct Result {
+        std::vector<Zone> zones;             // Ordered left to right (by first pixel in column-major order)
+        std::vector<std::uint32_t> labels;   // Row-major label map: 0 = no zone, i + 1 = zones[i]
+    };
+
+    struct Options {
+        // Number of horizontal bands labeled in parallel and merged at the seams (1 = single-threaded)
+        unsigned int bands = 1;
+    };
+
+    // Label an RGBA image with a row-major, run-based two-pass union-find sweep
+    Result detect(const std::uint8_t* rgba, unsigned int width, unsigned int height, const Options& options = Options());
+
+    // Band count worth using for an image of this size on this machine (1 for typical card overlays)
+    unsigned int suggestBandCount(unsigned int width, unsigned int height);
+}
@@ -0,0 +1,257 @@
+// Offline asset baker: decodes the game's PNGs once and writes them to a single pack file
+// (see AssetPack.h) that the game memory-maps and uploads from without decoding.
+//
+// The manifest lists one asset per line as "<kind> <path>":
+//   image    RGBA pixels for a standalone texture
+//   atlas    packed onto shared atlas pages, laid out exactly as the game would at runtime
+//   overlay  scratch overlay: RGBA pixels plus the zone table and label map ZoneDetector computes
+// Every entry stores a hash of its source file, so the game skips entries whose file has changed.
+//
+// Build:   cmake -S . -B build && cmake --build build --target asset_baker
+// Run:     build/asset_baker tools/assets.manifest assets/assets.pack
+
+#include "AssetPack.h"
+#include "TextureAtlas.h"
+#include "ZoneDetector.h"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr size_t BLOCK_ALIGNMENT = 16;
+
+    // One decoded source file
+    struct Source {
+        AssetPack::Kind kind = AssetPack::Kind::Image;
+        bool atlas = false;
+        std::string path;
+        std::uint64_t hash = 0;
+        sf::Image image;
+        ZoneDetector::Result zones;   // Overlays only
+    };
+
+    // Entry plus the name and data blocks it points at, before offsets are assigned
+    struct PendingEntry {
+        AssetPack::Entry entry{};
+        std::string name;
+        const std::uint8_t* pixels = nullptr;
+        size_t pixelBytes = 0;
+        const ZoneDetector::Result* zones = nullptr;
+        std::string pageName;   // AtlasRegion: name of its page entry
+    };
+
+    // Parse "<kind> <path>" lines; '#' starts a comment
+    bool loadManifest(const std::string& path, std::vector<Source>& sources) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "[Error] Failed to open manifest: " << path << std::endl;
+            return false;
+        }
+
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream in(line);
+            std::string kind;
+            Source source;
+            if (!(in >> kind)) continue;
+            if (!(in >> source.path)) {
+                std::cerr << "[Error] " << path << ":" << lineNumber << ": missing path" << std::endl;
+                return false;
+            }
+
+            if (kind == "image") source.kind = AssetPack::Kind::Image;
+            else if (kind == "atlas") source.atlas = true;
+            else if (kind == "overlay") source.kind = AssetPack::Kind::Overlay;
+            else {
+                std::cerr << "[Error] " << path << ":" << lineNumber << ": unknown kind '" << kind << "'" << std::endl;
+                return false;
+            }
+            sources.push_back(std::move(source));
+        }
+        return true;
+    }
+
+    // Read, hash and decode a source file; overlays also get their zones detected
+    bool decode(Source& source) {
+        std::ifstream file(source.path, std::ios::binary);
+        if (!file) {
+            std::cerr << "[Error] Failed to open " << source.path << std::endl;
+            return false;
+        }
+
+        const std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        source.hash = AssetPack::hash(contents.data(), contents.size());
+
+        if (contents.empty() || !source.image.loadFromMemory(contents.data(), contents.size())) {
+            std::cerr << "[Error] Failed to decode " << source.path << std::endl;
+            return false;
+        }
+
+        if (source.kind == AssetPack::Kind::Overlay) {
+            const sf::Vector2u size = source.image.getSize();
+            source.zones = ZoneDetector::detect(source.image.getPixelsPtr(), size.x, size.y);
+        }
+        return true;
+    }
+
+    size_t alignUp(size_t value) {
+        return (value + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+    }
+
+    template <typename T>
+    void writeAt(std::vector<std::uint8_t>& out, size_t offset, const T& value) {
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::string manifestPath = (argc > 1) ? argv[1] : "tools/assets.manifest";
+    const std::string outputPath = (argc > 2) ? argv[2] : "assets/assets.pack";
+
+    std::vector<Source> sources;
+    if (!loadManifest(manifestPath, sources)) return 1;
+    for (auto& source : sources) {
+        if (!decode(source)) return 1;
+    }
+
+    // Pack the atlas sources with the game's own page limit and padding
+    std::vector<const Source*> atlasSources;
+    std::vector<TextureAtlas::Input> atlasInputs;
+    for (const auto& source : sources) {
+        if (!source.atlas) continue;
+        atlasSources.push_back(&source);
+        atlasInputs.push_back({ source.image.getPixelsPtr(), source.image.getSize().x, source.image.getSize().y });
+    }
+    const TextureAtlas::Result atlas = TextureAtlas::pack(atlasInputs, TextureAtlas::MAX_PAGE_SIZE, TextureAtlas::PADDING);
+
+    std::vector<PendingEntry> pending;
+    for (size_t i = 0; i < atlas.pages.size(); ++i) {
+        PendingEntry page;
+        page.name = "atlas/page" + std::to_string(i);
+        page.entry.kind = AssetPack::Kind::AtlasPage;
+        page.entry.width = atlas.pages[i].width;
+        page.entry.height = atlas.pages[i].height;
+        page.pixels = atlas.pages[i].rgba.data();
+        page.pixelBytes = atlas.pages[i].rgba.size();
+        pending.push_back(std::move(page));
+    }
+
+    size_t atlasIndex = 0;
+    for (const auto& source : sources) {
+        PendingEntry item;
+        item.name = source.path;
+        item.entry.sourceHash = source.hash;
+        item.entry.width = source.image.getSize().x;
+        item.entry.height = source.image.getSize().y;
+
+        const TextureAtlas::Placement* placement = source.atlas ? &atlas.placements[atlasIndex++] : nullptr;
+        if (placement && placement->packed) {
+            item.entry.kind = AssetPack::Kind::AtlasRegion;
+            item.entry.left = placement->left;
+            item.entry.top = placement->top;
+            item.pageName = "atlas/page" + std::to_string(placement->page);
+        }
+        else {
+            // Standalone image, overlay, or an atlas source too large for a page
+            item.entry.kind = source.kind;
+            item.pixels = source.image.getPixelsPtr();
+            item.pixelBytes = static_cast<size_t>(item.entry.width) * item.entry.height * 4;
+            if (source.kind == AssetPack::Kind::Overlay) {
+                item.zones = &source.zones;
+                item.entry.zoneCount = static_cast<std::uint32_t>(source.zones.zones.size());
+            }
+        }
+        pending.push_back(std::move(item));
+    }
+
+    // The index is sorted by name hash for binary search
+    for (auto& item : pending) item.entry.nameHash = AssetPack::hash(item.name.data(), item.name.size());
+    std::sort(pending.begin(), pending.end(), [](const PendingEntry& a, const PendingEntry& b) {
+        return a.entry.nameHash != b.entry.nameHash ? a.entry.nameHash < b.entry.nameHash : a.name < b.name;
+    });
+    for (auto& item : pending) {
+        if (item.pageName.empty()) continue;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            if (pending[i].name == item.pageName) item.entry.page = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // Lay out: header, entries, names, then data blocks
+    size_t offset = alignUp(sizeof(AssetPack::Header));
+    const size_t entriesOffset = offset;
+    offset = alignUp(offset + pending.size() * sizeof(AssetPack::Entry));
+
+    for (auto& item : pending) {
+        item.entry.nameOffset = static_cast<std::uint32_t>(offset);
+        item.entry.nameLength = static_cast<std::uint32_t>(item.name.size());
+        offset += item.name.size();
+    }
+    for (auto& item : pending) {
+        if (item.pixels) {
+            offset = alignUp(offset);
+            item.entry.dataOffset = offset;
+            offset += item.pixelBytes;
+        }
+        if (item.zones) {
+            offset = alignUp(offset);
+            item.entry.zonesOffset = offset;
+            offset += item.zones->zones.size() * sizeof(AssetPack::Zone) + item.zones->labels.size() * sizeof(std::uint32_t);
+        }
+    }
+    const size_t fileSize = alignUp(offset);
+
+    std::vector<std::uint8_t> out(fileSize, 0);
+    AssetPack::Header header{};
+    header.magic = AssetPack::MAGIC;
+    header.version = AssetPack::VERSION;
+    header.entryCount = static_cast<std::uint32_t>(pending.size());
+    header.entriesOffset = entriesOffset;
+    header.fileSize = fileSize;
+    writeAt(out, 0, header);
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const PendingEntry& item = pending[i];
+        writeAt(out, entriesOffset + i * sizeof(AssetPack::Entry), item.entry);
+        std::memcpy(out.data() + item.entry.nameOffset, item.name.data(), item.name.size());
+
+        if (item.pixels) std::memcpy(out.data() + item.entry.dataOffset, item.pixels, item.pixelBytes);
+        if (item.zones) {
+            size_t zoneOffset = item.entry.zonesOffset;
+            for (const auto& zone : item.zones->zones) {
+                writeAt(out, zoneOffset, AssetPack::Zone{ zone.left, zone.top, zone.width, zone.height, zone.pixelCount });
+                zoneOffset += sizeof(AssetPack::Zone);
+            }
+            std::memcpy(out.data() + zoneOffset, item.zones->labels.data(), item.zones->labels.size() * sizeof(std::uint32_t));
+        }
+    }
+
+    std::ofstream file(outputPath, std::ios::binary);
+    if (!file || !file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()))) {
+        std::cerr << "[Error] Failed to write " << outputPath << std::endl;
+        return 1;
+    }
+    file.close();
+
+    // Read it back the way the game will
+    if (!AssetPack::open(outputPath)) {
+        std::cerr << "[Error] Written pack failed validation: " << outputPath << std::endl;
+        return 1;
+    }
+    AssetPack::close();
+
+    std::cout << "Baked " << sources.size() << " assets (" << atlasSources.size() << " atlased onto "
+        << atlas.pages.size() << " page(s)) into " << outputPath << ", " << fileSize << " bytes" << std::endl;
+    return 0;
+}
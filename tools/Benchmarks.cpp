@@ -0,0 +1,589 @@
+// Micro-benchmarks for the scratch engine, zone detection, prizes, shop, resource lookups, the player inventory and relic modifiers.
+//
+// Every input is generated in code (synthetic overlays, in-memory card templates, textures
+// registered without files), so the suite runs without the asset folder or a GPU context.
+// Fonts cannot be faked that way: the shop's texts use the empty default font, and ShopView
+// logs one "Font not found" warning per run.
+// Each benchmark is calibrated to run for a minimum time per sample, then sampled several
+// times; min / median / max nanoseconds per operation are written as JSON, one result per line.
+// Passing a previous run with --baseline compares medians and exits with status 2 when any
+// benchmark got slower than the tolerance allows.
+//
+// Build:   cmake -S . -B build && cmake --build build --target benchmarks
+// Run:     build/benchmarks [--out benchmark.json] [--baseline previous.json] [--tolerance 0.10] [--filter name] [--quick]
+
+#include "CardTemplate.h"
+#include "Log.h"
+#include "Player.h"
+#include "Random.h"
+#include "RelicPlan.h"
+#include "ResourceManager.h"
+#include "ScratchCard.h"
+#include "ScratchCardModel.h"
+#include "Shop.h"
+#include "ShopView.h"
+#include "ZoneDetector.h"
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr std::uint64_t BENCH_SEED = 0x5eed5eedULL;
+
+    // Keeps results observable so the optimiser cannot drop the measured work
+    volatile std::uint64_t sink = 0;
+
+    struct Options {
+        std::string outputPath = "benchmark.json";
+        std::string baselinePath;
+        std::string filter;
+        double tolerance = 0.10;        // Allowed median slowdown before a result counts as a regression
+        double minSampleSeconds = 0.05;
+        int samples = 7;
+    };
+
+    struct Result {
+        std::string id;                 // name plus parameters, stable across runs
+        std::string name;
+        std::string params;             // JSON object body
+        std::uint64_t iterations = 0;   // Operations per sample
+        double minNs = 0.0;
+        double medianNs = 0.0;
+        double maxNs = 0.0;
+    };
+
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Times `iterations` operations; the callable returns the seconds spent in the measured part only,
+    // so per-batch setup (fresh cards, copies) stays out of the numbers
+    using Batch = std::function<double(std::uint64_t iterations)>;
+
+    class Runner {
+    public:
+        explicit Runner(const Options& options) : options(options) {}
+
+        void run(const std::string& name, const std::vector<std::pair<std::string, long long>>& params, const Batch& batch) {
+            std::string id = name;
+            std::string paramsJson;
+            for (const auto& param : params) {
+                id += "/" + param.first + "=" + std::to_string(param.second);
+                if (!paramsJson.empty()) paramsJson += ",";
+                paramsJson += "\"" + param.first + "\":" + std::to_string(param.second);
+            }
+            if (!options.filter.empty() && id.find(options.filter) == std::string::npos) return;
+
+            // Grow the batch until one sample takes long enough to time reliably
+            std::uint64_t iterations = 1;
+            for (;;) {
+                const double elapsed = batch(iterations);
+                if (elapsed >= options.minSampleSeconds || iterations >= (1ULL << 40)) break;
+                const double scale = elapsed > 0.0 ? options.minSampleSeconds / elapsed * 1.2 : 10.0;
+                iterations = std::max(iterations + 1, static_cast<std::uint64_t>(iterations * std::min(scale, 10.0)));
+            }
+
+            std::vector<double> perOp;
+            for (int i = 0; i < options.samples; ++i) {
+                perOp.push_back(batch(iterations) * 1e9 / static_cast<double>(iterations));
+            }
+            std::sort(perOp.begin(), perOp.end());
+
+            Result result;
+            result.id = id;
+            result.name = name;
+            result.params = paramsJson;
+            result.iterations = iterations;
+            result.minNs = perOp.front();
+            result.medianNs = perOp[perOp.size() / 2];
+            result.maxNs = perOp.back();
+
+            std::cout << std::left << std::setw(56) << id << std::right << std::fixed << std::setprecision(1)
+                << std::setw(14) << result.medianNs << " ns/op  (min " << result.minNs << ")" << std::endl;
+            results.push_back(std::move(result));
+        }
+
+        const std::vector<Result>& getResults() const { return results; }
+
+    private:
+        const Options& options;
+        std::vector<Result> results;
+    };
+
+    // RGBA overlay of cols x rows zones on a width x height canvas: each zone is an opaque disc-cornered
+    // rectangle inside its cell, separated from its neighbours by transparent gutters
+    std::vector<std::uint8_t> makeOverlay(unsigned int width, unsigned int height, unsigned int cols, unsigned int rows) {
+        std::vector<std::uint8_t> rgba(static_cast<size_t>(width) * height * 4, 0);
+        const float cellW = static_cast<float>(width) / cols;
+        const float cellH = static_cast<float>(height) / rows;
+        const float gutter = std::max(1.f, std::min(cellW, cellH) * 0.1f);
+        const float corner = std::min(cellW, cellH) * 0.3f;
+
+        for (unsigned int y = 0; y < height; ++y) {
+            const unsigned int row = std::min(rows - 1, static_cast<unsigned int>(y / cellH));
+            const float localY = y - row * cellH;
+            for (unsigned int x = 0; x < width; ++x) {
+                const unsigned int col = std::min(cols - 1, static_cast<unsigned int>(x / cellW));
+                const float localX = x - col * cellW;
+
+                // Inside the cell minus the gutter, with rounded corners
+                const float left = gutter, top = gutter, right = cellW - gutter, bottom = cellH - gutter;
+                if (localX < left || localX >= right || localY < top || localY >= bottom) continue;
+                const float dx = std::max({ left + corner - localX, 0.f, localX - (right - corner) });
+                const float dy = std::max({ top + corner - localY, 0.f, localY - (bottom - corner) });
+                if (dx * dx + dy * dy > corner * corner) continue;
+
+                std::uint8_t* pixel = &rgba[(static_cast<size_t>(y) * width + x) * 4];
+                pixel[0] = 192;
+                pixel[1] = 192;
+                pixel[2] = 192;
+                pixel[3] = 255;
+            }
+        }
+        return rgba;
+    }
+
+    // Grid of at least `zones` cells, as square as the count allows
+    void gridFor(unsigned int zones, unsigned int& cols, unsigned int& rows) {
+        cols = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<double>(zones))));
+        rows = (zones + cols - 1) / cols;
+    }
+
+    std::shared_ptr<const CardTemplate> makeCardTemplate(unsigned int width, unsigned int height, unsigned int cols, unsigned int rows) {
+        const std::vector<std::uint8_t> rgba = makeOverlay(width, height, cols, rows);
+        sf::Image image;
+        image.create(width, height, rgba.data());
+        return CardTemplate::fromOverlay(image);
+    }
+
+    // Serpentine brush path across the card, one sample every `step` pixels
+    std::vector<sf::Vector2f> makeScratchPath(unsigned int width, unsigned int height, int step) {
+        std::vector<sf::Vector2f> path;
+        bool forward = true;
+        for (int y = step / 2; y < static_cast<int>(height); y += step) {
+            for (int i = 0; i < static_cast<int>(width); i += step) {
+                const int x = forward ? i : static_cast<int>(width) - 1 - i;
+                path.emplace_back(static_cast<float>(x), static_cast<float>(y));
+            }
+            forward = !forward;
+        }
+        return path;
+    }
+
+    void benchScratchAt(Runner& runner) {
+        const struct { unsigned int width, height, cols, rows; } cards[] = {
+            { 128, 64, 4, 2 },
+            { 256, 128, 6, 3 },
+            { 512, 256, 10, 5 },
+        };
+        const int radii[] = { 4, 8, 16, 32 };
+
+        for (const auto& card : cards) {
+            const auto cardTemplate = makeCardTemplate(card.width, card.height, card.cols, card.rows);
+            for (int radius : radii) {
+                // Steps of half a radius: every stamp clears new pixels, as a real drag does
+                const std::vector<sf::Vector2f> path = makeScratchPath(card.width, card.height, std::max(1, radius / 2));
+
+                runner.run("scratchAt", { { "width", card.width }, { "height", card.height }, { "radius", radius } },
+                    [&](std::uint64_t iterations) {
+                        double elapsed = 0.0;
+                        std::uint64_t done = 0;
+                        while (done < iterations) {
+                            // Fresh card per pass over the path (untimed)
+                            Player player;
+                            ScratchCard scratchCard(cardTemplate, 1.f);
+                            scratchCard.setPosition(0.f, 0.f);
+                            scratchCard.setBrush(BrushShape::Circle, radius);
+
+                            const std::uint64_t count = std::min<std::uint64_t>(iterations - done, path.size());
+                            const auto start = std::chrono::steady_clock::now();
+                            for (std::uint64_t i = 0; i < count; ++i) {
+                                sink += scratchCard.scratchAt(path[i].x, path[i].y, player);
+                            }
+                            elapsed += secondsSince(start);
+                            done += count;
+                        }
+                        return elapsed;
+                    });
+            }
+        }
+    }
+
+    void benchDetectZones(Runner& runner) {
+        constexpr unsigned int SIZE = 1024;
+        const unsigned int zoneCounts[] = { 1, 10, 100, 1000, 10000 };
+        const unsigned int suggestedBands = ZoneDetector::suggestBandCount(SIZE, SIZE);
+
+        for (unsigned int zones : zoneCounts) {
+            unsigned int cols = 0, rows = 0;
+            gridFor(zones, cols, rows);
+            const std::vector<std::uint8_t> rgba = makeOverlay(SIZE, SIZE, cols, rows);
+
+            std::vector<unsigned int> bandCounts = { 1 };
+            if (suggestedBands > 1) bandCounts.push_back(suggestedBands);
+
+            for (unsigned int bands : bandCounts) {
+                ZoneDetector::Options options;
+                options.bands = bands;
+                runner.run("detectZones", { { "size", SIZE }, { "zones", cols * rows }, { "bands", bands } },
+                    [&](std::uint64_t iterations) {
+                        const auto start = std::chrono::steady_clock::now();
+                        for (std::uint64_t i = 0; i < iterations; ++i) {
+                            sink += ZoneDetector::detect(rgba.data(), SIZE, SIZE, options).zones.size();
+                        }
+                        return secondsSince(start);
+                    });
+            }
+        }
+    }
+
+    void benchPrizes(Runner& runner) {
+        const unsigned int zoneCounts[] = { 5, 25, 100 };
+
+        for (unsigned int zones : zoneCounts) {
+            unsigned int cols = 0, rows = 0;
+            gridFor(zones, cols, rows);
+            const std::vector<std::uint8_t> rgba = makeOverlay(cols * 24, rows * 24, cols, rows);
+            const auto layout = CardLayout::fromOverlay(rgba.data(), cols * 24, rows * 24);
+
+            runner.run("assignRandomPrizes", { { "zones", layout->zones.size() } }, [&](std::uint64_t iterations) {
+                ScratchCardModel model(layout);
+                RandomStream rng(BENCH_SEED, 1);
+                const auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    model.assignRandomPrizes(rng);
+                    sink += static_cast<std::uint64_t>(model.getZonePrize(0).type);
+                }
+                return secondsSince(start);
+            });
+
+            runner.run("applyWinningsToPlayer", { { "zones", layout->zones.size() } }, [&](std::uint64_t iterations) {
+                // Winnings apply once per card, so every operation gets its own fully revealed copy (untimed)
+                Player player;
+                ScratchCardModel revealed(layout);
+                RandomStream rng(BENCH_SEED, 2);
+                revealed.assignRandomPrizes(rng);
+                for (size_t zone = 0; zone < revealed.getZoneCount(); ++zone) revealed.revealZone(zone, player);
+
+                constexpr std::uint64_t CHUNK = 256;
+                std::vector<ScratchCardModel> cards;
+                double elapsed = 0.0;
+                for (std::uint64_t done = 0; done < iterations; done += cards.size()) {
+                    cards.assign(static_cast<size_t>(std::min(CHUNK, iterations - done)), revealed);
+                    const auto start = std::chrono::steady_clock::now();
+                    for (auto& card : cards) card.applyWinningsToPlayer(player);
+                    elapsed += secondsSince(start);
+                }
+                sink += static_cast<std::uint64_t>(player.getBalance());
+                return elapsed;
+            });
+        }
+    }
+
+    // Placeholder textures for the names the shop and cards draw; never uploaded, so no GPU is needed
+    std::vector<std::unique_ptr<sf::Texture>> registerPlaceholderTextures(size_t extraNames) {
+        std::vector<std::string> names = { "shop_bg", "reroll_button", "next_round_button", "relic_1", "relic_2",
+            "card_shop", "lucky_7_shop", "lucky_7", "dust", "7", "empty" };
+        for (size_t i = 0; i < extraNames; ++i) names.push_back("bench_texture_" + std::to_string(i));
+
+        std::vector<std::unique_ptr<sf::Texture>> textures;
+        for (size_t i = 0; i < names.size(); ++i) {
+            textures.push_back(std::make_unique<sf::Texture>());
+            ResourceManager::registerRegion(names[i], { textures.back().get(), sf::IntRect(0, 0, 16 + static_cast<int>(i % 8), 16) });
+        }
+        return textures;
+    }
+
+    void benchShop(Runner& runner) {
+        runner.run("Shop::generateNewShop", {}, [](std::uint64_t iterations) {
+            Shop shop;
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                shop.generateNewShop();
+                sink += shop.getScratchCards().size();
+            }
+            return secondsSince(start);
+        });
+
+        ShopView shopView;
+        runner.run("ShopView::reroll", {}, [&](std::uint64_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                shopView.reroll();
+                sink += static_cast<std::uint64_t>(shopView.getCardsBought());
+            }
+            return secondsSince(start);
+        });
+    }
+
+    void benchResourceLookups(Runner& runner, size_t registeredNames) {
+        const std::vector<std::string> names = { "lucky_7_shop", "relic_1", "relic_2", "dust", "7", "empty",
+            "bench_texture_" + std::to_string(registeredNames - 1) };
+        std::vector<TextureId> ids;
+        for (const auto& name : names) ids.push_back(ResourceManager::textureId(name));
+
+        const long long total = static_cast<long long>(registeredNames + 11);
+        runner.run("ResourceManager::getRegion(name)", { { "registered", total } }, [&](std::uint64_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                sink += static_cast<std::uint64_t>(ResourceManager::getRegion(names[i % names.size()]).rect.width);
+            }
+            return secondsSince(start);
+        });
+
+        runner.run("ResourceManager::getRegion(id)", { { "registered", total } }, [&](std::uint64_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                sink += static_cast<std::uint64_t>(ResourceManager::getRegion(ids[i % ids.size()]).rect.width);
+            }
+            return secondsSince(start);
+        });
+
+        runner.run("ResourceManager::setSpriteTexture(name)", { { "registered", total } }, [&](std::uint64_t iterations) {
+            sf::Sprite sprite;
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                ResourceManager::setSpriteTexture(sprite, names[i % names.size()]);
+                sink += static_cast<std::uint64_t>(sprite.getTextureRect().width);
+            }
+            return secondsSince(start);
+        });
+
+        runner.run("ResourceManager::setSpriteTexture(id)", { { "registered", total } }, [&](std::uint64_t iterations) {
+            sf::Sprite sprite;
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                ResourceManager::setSpriteTexture(sprite, ids[i % ids.size()]);
+                sink += static_cast<std::uint64_t>(sprite.getTextureRect().width);
+            }
+            return secondsSince(start);
+        });
+
+        runner.run("ResourceManager::textureId", { { "registered", total } }, [&](std::uint64_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                sink += ResourceManager::textureId(names[i % names.size()]).index;
+            }
+            return secondsSince(start);
+        });
+    }
+
+    // Inventory operations with `distinct` different cards and relics owned, as in long bot runs
+    void benchInventory(Runner& runner) {
+        const unsigned int distinctCounts[] = { 10, 10000 };
+
+        for (unsigned int distinct : distinctCounts) {
+            std::vector<CardId> cards;
+            std::vector<RelicId> relics;
+            for (unsigned int i = 0; i < distinct; ++i) {
+                cards.push_back(Catalog::cardId("bench_card_" + std::to_string(i)));
+                relics.push_back(Catalog::relicId("bench_relic_" + std::to_string(i)));
+            }
+
+            Player player;
+            for (unsigned int i = 0; i < distinct; ++i) {
+                player.addCard(cards[i]);
+                player.addRelic(relics[i]);
+            }
+
+            runner.run("Player::addCard+useCard", { { "distinct", distinct } }, [&](std::uint64_t iterations) {
+                const auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    // Takes the card's count from 1 to 2 and back, or to 0 and back through the owned list
+                    const CardId card = cards[i % cards.size()];
+                    if (i & 1) {
+                        player.useCard(card);
+                        player.addCard(card);
+                    }
+                    else {
+                        player.addCard(card);
+                        player.useCard(card);
+                    }
+                }
+                sink += static_cast<std::uint64_t>(player.getCardTotal());
+                return secondsSince(start);
+            });
+
+            runner.run("Player::hasRelic", { { "distinct", distinct } }, [&](std::uint64_t iterations) {
+                const auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    sink += player.hasRelic(relics[(i * 7919) % relics.size()]) ? 1 : 0;
+                }
+                return secondsSince(start);
+            });
+
+            runner.run("Player::getOwnedCards", { { "distinct", distinct } }, [&](std::uint64_t iterations) {
+                const auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    int total = 0;
+                    for (CardId card : player.getOwnedCards()) total += player.getCardCount(card);
+                    sink += static_cast<std::uint64_t>(total);
+                }
+                return secondsSince(start);
+            });
+        }
+    }
+
+    // Relic plan compile with every defined relic stacked `stack` times, and card payout through the compiled rules
+    void benchRelicPlan(Runner& runner) {
+        const int stacks[] = { 1, 1000 };
+
+        for (int stack : stacks) {
+            Player player;
+            for (const Relic& relic : Relic::definitions()) {
+                const RelicId id = Catalog::relicId(relic.id);
+                for (int i = 0; i < stack; ++i) player.addRelic(id);
+            }
+
+            RelicPlan plan;
+            runner.run("RelicPlan::compile", { { "stack", stack } }, [&](std::uint64_t iterations) {
+                const auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    plan.compile(player);
+                    sink += static_cast<std::uint64_t>(plan.getRules().moneyChance);
+                }
+                return secondsSince(start);
+            });
+
+            runner.run("RelicPlan::payout", { { "stack", stack } }, [&](std::uint64_t iterations) {
+                const PrizeRules& rules = plan.getRules();
+                const auto start = std::chrono::steady_clock::now();
+                for (std::uint64_t i = 0; i < iterations; ++i) {
+                    sink += static_cast<std::uint64_t>(rules.payout(static_cast<int>(i % 6), 1.5f) + plan.getShopPrice(25));
+                }
+                return secondsSince(start);
+            });
+        }
+    }
+
+    bool writeJson(const std::string& path, const std::vector<Result>& results) {
+        std::ofstream file(path);
+        if (!file) return false;
+
+#ifdef NDEBUG
+        const char* build = "release";
+#else
+        const char* build = "debug";
+#endif
+        file << "{\"suite\":\"scratchrogue\",\"version\":1,\"build\":\"" << build << "\",\"threads\":"
+            << std::thread::hardware_concurrency() << ",\"results\":[\n";
+        file << std::setprecision(6);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            file << "{\"id\":\"" << r.id << "\",\"name\":\"" << r.name << "\",\"params\":{" << r.params
+                << "},\"iterations\":" << r.iterations << ",\"min_ns\":" << r.minNs << ",\"median_ns\":" << r.medianNs
+                << ",\"max_ns\":" << r.maxNs << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        file << "]}\n";
+        return static_cast<bool>(file);
+    }
+
+    // Medians by id from a file written by writeJson (one result per line)
+    bool readBaseline(const std::string& path, std::map<std::string, double>& medians) {
+        std::ifstream file(path);
+        if (!file) return false;
+
+        std::string line;
+        while (std::getline(file, line)) {
+            const size_t idStart = line.find("\"id\":\"");
+            const size_t medianStart = line.find("\"median_ns\":");
+            if (idStart == std::string::npos || medianStart == std::string::npos) continue;
+
+            const size_t idBegin = idStart + 6;
+            const size_t idEnd = line.find('"', idBegin);
+            medians[line.substr(idBegin, idEnd - idBegin)] = std::strtod(line.c_str() + medianStart + 12, nullptr);
+        }
+        return true;
+    }
+
+    // Print the change of every median against the baseline; returns the number of regressions
+    int compareWithBaseline(const std::vector<Result>& results, const std::map<std::string, double>& baseline, double tolerance) {
+        int regressions = 0;
+        std::cout << "\nAgainst baseline (tolerance " << tolerance * 100.0 << "%):" << std::endl;
+        for (const Result& result : results) {
+            auto it = baseline.find(result.id);
+            if (it == baseline.end() || it->second <= 0.0) {
+                std::cout << "  new      " << result.id << std::endl;
+                continue;
+            }
+
+            const double change = result.medianNs / it->second - 1.0;
+            const bool regressed = change > tolerance;
+            regressions += regressed ? 1 : 0;
+            std::cout << (regressed ? "  SLOWER   " : "  ok       ") << std::left << std::setw(56) << result.id << std::right
+                << std::showpos << std::setprecision(1) << change * 100.0 << "%" << std::noshowpos << std::endl;
+        }
+        return regressions;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--out" && hasValue) options.outputPath = argv[++i];
+        else if (arg == "--baseline" && hasValue) options.baselinePath = argv[++i];
+        else if (arg == "--tolerance" && hasValue) options.tolerance = std::atof(argv[++i]);
+        else if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--quick") {
+            options.minSampleSeconds = 0.01;
+            options.samples = 3;
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--out file] [--baseline file] [--tolerance fraction] [--filter text] [--quick]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Per-card info logs would dominate the timings; keep warnings and errors only
+    Log::setLevel(Log::Level::Warn);
+    Random::setRunSeed(BENCH_SEED);
+
+    constexpr size_t EXTRA_TEXTURE_NAMES = 256;
+    const auto placeholderTextures = registerPlaceholderTextures(EXTRA_TEXTURE_NAMES);
+
+    Runner runner(options);
+    benchScratchAt(runner);
+    benchDetectZones(runner);
+    benchPrizes(runner);
+    benchShop(runner);
+    benchResourceLookups(runner, EXTRA_TEXTURE_NAMES);
+    benchInventory(runner);
+    benchRelicPlan(runner);
+
+    if (!writeJson(options.outputPath, runner.getResults())) {
+        std::cerr << "[Error] Failed to write " << options.outputPath << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << runner.getResults().size() << " results to " << options.outputPath << std::endl;
+
+    int status = 0;
+    if (!options.baselinePath.empty()) {
+        std::map<std::string, double> baseline;
+        if (!readBaseline(options.baselinePath, baseline)) {
+            std::cerr << "[Error] Failed to read baseline " << options.baselinePath << std::endl;
+            status = 1;
+        }
+        else if (compareWithBaseline(runner.getResults(), baseline, options.tolerance) > 0) {
+            status = 2;
+        }
+    }
+
+    Log::shutdown();
+    return status;
+}
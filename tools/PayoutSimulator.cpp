@@ -0,0 +1,237 @@
+// Headless Monte Carlo payout simulator for scratch card balance tuning.
+//
+// Generates and resolves cards with the same PrizeRules the game uses, spread across all cores,
+// and reports mean, variance, percentiles and the full payout histogram per card type.
+// Odds, payout tables and card types come from a config file, so tuning needs no rebuild.
+//
+// Build:   cmake -S . -B build && cmake --build build --target payout_sim
+// Run:     build/payout_sim tools/payout_sim.cfg
+//
+// Every chunk of cards draws from its own RNG stream derived from (seed, card type, chunk),
+// so results are reproducible for a given seed whatever the thread count.
+
+#include "PrizeRules.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // One card type to simulate: its zone count, shop price and prize rules
+    struct CardSpec {
+        std::string id;
+        int zones = 5;
+        int price = 0;
+        PrizeRules rules;
+    };
+
+    struct Config {
+        std::uint64_t cards = 10000000;     // Cards simulated per card type
+        unsigned int threads = 0;           // 0 = all hardware threads
+        std::uint64_t seed = 1;
+        std::vector<CardSpec> cardSpecs;
+    };
+
+    // Parse "key value..." lines; '#' starts a comment. Rule keys apply to every card line after them.
+    bool loadConfig(const std::string& path, Config& config) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "[Error] Failed to open config: " << path << std::endl;
+            return false;
+        }
+
+        PrizeRules rules;
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream in(line);
+            std::string key;
+            if (!(in >> key)) continue;
+
+            bool ok = true;
+            if (key == "cards") ok = static_cast<bool>(in >> config.cards) && config.cards > 0;
+            else if (key == "threads") ok = static_cast<bool>(in >> config.threads);
+            else if (key == "seed") ok = static_cast<bool>(in >> config.seed);
+            else if (key == "money_chance") ok = static_cast<bool>(in >> rules.moneyChance);
+            else if (key == "none_chance") ok = static_cast<bool>(in >> rules.noneChance);
+            else if (key == "multiplier_min") ok = static_cast<bool>(in >> rules.multiplierMin);
+            else if (key == "multiplier_span") ok = static_cast<bool>(in >> rules.multiplierSpan);
+            else if (key == "rewards") {
+                rules.lucky7Rewards.clear();
+                int reward;
+                while (in >> reward) rules.lucky7Rewards.push_back(reward);
+            }
+            else if (key == "card") {
+                CardSpec spec;
+                ok = static_cast<bool>(in >> spec.id >> spec.zones >> spec.price) && spec.zones >= 0;
+
+                // Payouts index the histogram, so they must never go negative
+                bool rewardsValid = std::all_of(rules.lucky7Rewards.begin(), rules.lucky7Rewards.end(),
+                    [](int reward) { return reward >= 0; });
+                if (!rewardsValid || rules.multiplierMin < 0.f || rules.multiplierSpan < 0.f) {
+                    std::cerr << "[Error] " << path << ":" << lineNumber << ": rewards and multipliers must not be negative" << std::endl;
+                    return false;
+                }
+
+                spec.rules = rules;
+                config.cardSpecs.push_back(spec);
+            }
+            else {
+                std::cerr << "[Error] " << path << ":" << lineNumber << ": unknown key '" << key << "'" << std::endl;
+                return false;
+            }
+
+            if (!ok) {
+                std::cerr << "[Error] " << path << ":" << lineNumber << ": bad value for '" << key << "'" << std::endl;
+                return false;
+            }
+        }
+
+        if (config.cardSpecs.empty()) {
+            std::cerr << "[Error] No 'card' lines in " << path << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    constexpr std::uint64_t CHUNK_CARDS = 1 << 16;
+
+    // Resolve count cards into the histogram. Mirrors ScratchCardModel:
+    // every zone gets a prize roll, then the fully revealed card pays rules.payout.
+    void simulateChunk(const CardSpec& spec, RandomStream& rng, std::uint64_t count, std::vector<std::uint64_t>& histogram) {
+        const PrizeRules& rules = spec.rules;
+        for (std::uint64_t card = 0; card < count; ++card) {
+            int lucky7Count = 0;
+            float multiplier = 1.f;
+
+            for (int zone = 0; zone < spec.zones; ++zone) {
+                switch (rules.rollType(static_cast<int>(rng.below(100)))) {
+                case PrizeType::Money: ++lucky7Count; break;
+                case PrizeType::Multiplier: multiplier += rules.multiplierFor(rng.unit()); break;
+                default: break;
+                }
+            }
+
+            ++histogram[rules.payout(lucky7Count, multiplier)];
+        }
+    }
+
+    // Value at quantile q of a histogram holding total samples
+    int percentile(const std::vector<std::uint64_t>& histogram, std::uint64_t total, double q) {
+        const std::uint64_t target = static_cast<std::uint64_t>(q * static_cast<double>(total - 1));
+        std::uint64_t seen = 0;
+        for (size_t payout = 0; payout < histogram.size(); ++payout) {
+            seen += histogram[payout];
+            if (seen > target) return static_cast<int>(payout);
+        }
+        return static_cast<int>(histogram.size()) - 1;
+    }
+
+    // Print summary statistics and every non-empty histogram bucket
+    void report(const CardSpec& spec, const std::vector<std::uint64_t>& histogram, std::uint64_t total, double seconds) {
+        long double sum = 0, sumSquares = 0;
+        std::uint64_t winners = 0;
+        int minPayout = -1, maxPayout = 0;
+        for (size_t payout = 0; payout < histogram.size(); ++payout) {
+            if (histogram[payout] == 0) continue;
+            const long double n = static_cast<long double>(histogram[payout]);
+            sum += n * payout;
+            sumSquares += n * payout * payout;
+            if (payout > 0) winners += histogram[payout];
+            if (minPayout < 0) minPayout = static_cast<int>(payout);
+            maxPayout = static_cast<int>(payout);
+        }
+
+        const long double mean = sum / total;
+        const long double variance = sumSquares / total - mean * mean;
+
+        std::cout << std::fixed << std::setprecision(4)
+            << "== " << spec.id << " (" << spec.zones << " zones, price " << spec.price << ") ==\n"
+            << "cards       " << total << "\n"
+            << "throughput  " << std::setprecision(1) << (total / seconds / 1e6) << " M cards/s\n" << std::setprecision(4)
+            << "mean        " << static_cast<double>(mean) << "\n"
+            << "variance    " << static_cast<double>(variance) << "\n"
+            << "stddev      " << std::sqrt(static_cast<double>(variance)) << "\n"
+            << "win rate    " << (100.0 * winners / total) << " %\n";
+        if (spec.price > 0) {
+            std::cout << "return      " << static_cast<double>(100.0L * mean / spec.price) << " % of price\n";
+        }
+        std::cout << "min / max   " << minPayout << " / " << maxPayout << "\n"
+            << "p50 p90 p99 p99.9 p99.99  "
+            << percentile(histogram, total, 0.5) << " "
+            << percentile(histogram, total, 0.9) << " "
+            << percentile(histogram, total, 0.99) << " "
+            << percentile(histogram, total, 0.999) << " "
+            << percentile(histogram, total, 0.9999) << "\n"
+            << "histogram (payout count fraction)\n";
+
+        for (size_t payout = 0; payout < histogram.size(); ++payout) {
+            if (histogram[payout] == 0) continue;
+            std::cout << "  " << std::setw(6) << payout << " " << std::setw(14) << histogram[payout]
+                << " " << std::setprecision(8) << (static_cast<double>(histogram[payout]) / total)
+                << std::setprecision(4) << "\n";
+        }
+        std::cout << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::string path = (argc > 1) ? argv[1] : "tools/payout_sim.cfg";
+
+    Config config;
+    if (!loadConfig(path, config)) return 1;
+
+    const unsigned int threadCount = config.threads > 0
+        ? config.threads
+        : std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t cardIndex = 0; cardIndex < config.cardSpecs.size(); ++cardIndex) {
+        const CardSpec& spec = config.cardSpecs[cardIndex];
+
+        // Largest possible payout bounds the histogram: every zone a top multiplier
+        const float maxMultiplier = 1.f + spec.zones * (spec.rules.multiplierMin + spec.rules.multiplierSpan);
+        const size_t buckets = static_cast<size_t>(spec.rules.maxBaseReward() * maxMultiplier) + 2;
+
+        const std::uint64_t chunks = (config.cards + CHUNK_CARDS - 1) / CHUNK_CARDS;
+        std::atomic<std::uint64_t> nextChunk{ 0 };
+        std::vector<std::vector<std::uint64_t>> histograms(threadCount, std::vector<std::uint64_t>(buckets, 0));
+
+        auto worker = [&](unsigned int thread) {
+            std::vector<std::uint64_t>& histogram = histograms[thread];
+            for (std::uint64_t chunk = nextChunk++; chunk < chunks; chunk = nextChunk++) {
+                RandomStream rng = RandomStream(config.seed).derive(cardIndex).derive(chunk);
+                const std::uint64_t count = std::min(CHUNK_CARDS, config.cards - chunk * CHUNK_CARDS);
+                simulateChunk(spec, rng, count, histogram);
+            }
+        };
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < threadCount; ++t) workers.emplace_back(worker, t);
+        worker(0);
+        for (auto& w : workers) w.join();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<std::uint64_t> merged(buckets, 0);
+        for (const auto& histogram : histograms) {
+            for (size_t i = 0; i < buckets; ++i) merged[i] += histogram[i];
+        }
+
+        report(spec, merged, config.cards, seconds);
+    }
+
+    return 0;
+}